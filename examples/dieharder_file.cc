@@ -57,6 +57,7 @@
 #include "trng/mt19937.hpp"
 #include "trng/mt19937_64.hpp"
 #include "trng/count128_lcg_shift.hpp"
+#include "trng/philox4x32.hpp"
 
 
 template<typename T>
@@ -122,6 +123,7 @@ int main(int argc, char *argv[]) {
   add_generator<trng::mt19937>(func_map);
   add_generator<trng::mt19937_64>(func_map);
   add_generator<trng::count128_lcg_shift>(func_map);
+  add_generator<trng::philox4x32>(func_map);
 
   try {
     if (argc != 3 and argc != 4)
@@ -42,6 +42,7 @@
 #include <trng/lcg64_shift.hpp>
 #include <trng/lcg64_count_shift.hpp>
 #include <trng/count128_lcg_shift.hpp>
+#include <trng/philox4x32.hpp>
 #include <trng/mrg2.hpp>
 #include <trng/mrg3.hpp>
 #include <trng/mrg3s.hpp>
@@ -54,6 +55,7 @@
 #include <trng/yarn4.hpp>
 #include <trng/yarn5.hpp>
 #include <trng/yarn5s.hpp>
+#include <trng/simd_mrg.hpp>
 #include <trng/mt19937_64.hpp>
 #include <trng/mt19937.hpp>
 #include <trng/lagfib2xor.hpp>
@@ -234,6 +236,10 @@ int main(void) {
       trng::count128_lcg_shift r;
       time_main(r, "trng::count128_lcg_shift");
     }
+    {
+      trng::philox4x32 r;
+      time_main(r, "trng::philox4x32");
+    }
     {
       trng::mrg2 r;
       time_main(r, "trng::mrg2");
@@ -282,6 +288,18 @@ int main(void) {
       trng::yarn5s r;
       time_main(r, "trng::yarn5s");
     }
+    {
+      trng::simd_mrg<trng::mrg3, 8> r;
+      time_main(r, "trng::simd_mrg<mrg3, 8>");
+    }
+    {
+      trng::simd_mrg<trng::mrg5s, 8> r;
+      time_main(r, "trng::simd_mrg<mrg5s, 8>");
+    }
+    {
+      trng::simd_mrg<trng::yarn5s, 8> r;
+      time_main(r, "trng::simd_mrg<yarn5s, 8>");
+    }
     {
       trng::mt19937 r;
       time_main(r, "trng::mt19937");
@@ -0,0 +1,106 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// samples table-based discrete distributions with a different parameter for every call, as
+// in agent-based models, and reports the time and the number of heap allocations per call
+
+#include <cstdlib>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <new>
+#include <trng/lcg64_shift.hpp>
+#include <trng/binomial_dist.hpp>
+#include <trng/poisson_dist.hpp>
+#include <trng/hypergeometric_dist.hpp>
+#include <trng/negative_binomial_dist.hpp>
+#include <trng/discrete_dist.hpp>
+
+
+static std::size_t allocations{0};
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (void *p = std::malloc(size == 0 ? 1 : size))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+
+template<typename dist>
+void time_param(const std::vector<typename dist::param_type> &params, const std::string &name) {
+  trng::lcg64_shift r;
+  dist d(params.front());
+  const long samples{1000000};
+  long s{0};
+  const std::size_t allocations0{allocations};
+  const auto t0{std::chrono::high_resolution_clock::now()};
+  for (long i{0}; i < samples; ++i)
+    s += d(r, params[static_cast<std::size_t>(i) % params.size()]);
+  const auto t1{std::chrono::high_resolution_clock::now()};
+  const std::size_t allocations1{allocations};
+  std::cout << name << '\t' << 1e9 * std::chrono::duration<double>(t1 - t0).count() / samples
+            << " ns/call\t" << static_cast<double>(allocations1 - allocations0) / samples
+            << " allocations/call\t(" << s % 10 << ")\n";
+}
+
+
+int main() {
+  const int params{100};
+  std::vector<trng::binomial_dist::param_type> binomial;
+  std::vector<trng::poisson_dist::param_type> poisson;
+  std::vector<trng::hypergeometric_dist::param_type> hypergeometric;
+  std::vector<trng::negative_binomial_dist::param_type> negative_binomial;
+  std::vector<trng::discrete_dist::param_type> discrete;
+  for (int i{0}; i < params; ++i) {
+    const double p{(i + 1.0) / (params + 1.0)};
+    binomial.emplace_back(p, 1000);
+    poisson.emplace_back(10.0 + i);
+    hypergeometric.emplace_back(1000, 100 + i, 200);
+    negative_binomial.emplace_back(p, 10.0);
+    const std::vector<double> weights(1000, 1.0 + i);
+    discrete.emplace_back(weights.begin(), weights.end());
+  }
+  time_param<trng::binomial_dist>(binomial, "binomial_dist         ");
+  time_param<trng::poisson_dist>(poisson, "poisson_dist          ");
+  time_param<trng::hypergeometric_dist>(hypergeometric, "hypergeometric_dist   ");
+  time_param<trng::negative_binomial_dist>(negative_binomial, "negative_binomial_dist");
+  time_param<trng::discrete_dist>(discrete, "discrete_dist         ");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// compares the sampling time of fast_discrete_dist with an alias table that keeps thresholds
+// and aliases in separate arrays, for numbers of outcomes from 10^2 to 10^n, where n may be
+// given as command line argument (default 7)
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <numeric>
+#include <chrono>
+#include <trng/lcg64_shift.hpp>
+#include <trng/uniform01_dist.hpp>
+#include <trng/fast_discrete_dist.hpp>
+
+
+// alias method with thresholds and aliases in separate arrays
+class split_alias {
+  std::vector<double> F;
+  std::vector<int> L;
+
+public:
+  explicit split_alias(const std::vector<double> &p) : F(p.size()), L(p.size()) {
+    const double N{static_cast<double>(p.size())};
+    const double s{std::accumulate(p.begin(), p.end(), 0.0)};
+    std::vector<int> G, S;
+    for (int i{0}; i < static_cast<int>(p.size()); ++i) {
+      F[i] = N * p[i] / s;
+      L[i] = i;
+      (F[i] < 1.0 ? S : G).push_back(i);
+    }
+    while (not S.empty() and not G.empty()) {
+      const int k{G.back()}, j{S.back()};
+      L[j] = k;
+      F[k] -= 1.0 - F[j];
+      S.pop_back();
+      if (F[k] < 1.0) {
+        G.pop_back();
+        S.push_back(k);
+      }
+    }
+  }
+  template<typename R>
+  int operator()(R &r) {
+    const double U{trng::uniform01_dist<double>()(r) * F.size()};
+    const int I{static_cast<int>(U)};
+    return U - I <= F[I] ? I : L[I];
+  }
+};
+
+
+template<typename dist>
+double time_dist(dist &d, trng::lcg64_shift &r, long &s) {
+  const long samples{10000000};
+  const auto t0{std::chrono::high_resolution_clock::now()};
+  for (long i{0}; i < samples; ++i)
+    s += d(r);
+  const auto t1{std::chrono::high_resolution_clock::now()};
+  return 1e9 * std::chrono::duration<double>(t1 - t0).count() / samples;
+}
+
+
+int main(int argc, char *argv[]) {
+  const int n_max{argc > 1 ? std::atoi(argv[1]) : 7};
+  trng::lcg64_shift r;
+  trng::uniform01_dist<double> u;
+  long s{0};
+  std::cout << "N\tsplit arrays\tfast_discrete_dist\n";
+  long N{100};
+  for (int n{2}; n <= n_max; ++n, N *= 10) {
+    std::vector<double> p;
+    for (long i{0}; i < N; ++i)
+      p.push_back(u(r));
+    double t_split, t_packed;
+    {
+      split_alias d(p);
+      t_split = time_dist(d, r, s);
+    }
+    {
+      trng::fast_discrete_dist d(p.begin(), p.end());
+      t_packed = time_dist(d, r, s);
+    }
+    std::cout << "1e" << n << '\t' << t_split << " ns\t" << t_packed << " ns\n";
+  }
+  std::cout << '(' << s % 10 << ")\n";
+  return EXIT_SUCCESS;
+}
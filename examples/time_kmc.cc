@@ -0,0 +1,119 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// kinetic Monte Carlo simulation of a lattice gas on a square lattice with periodic boundary
+// conditions, the rate of a site depends on its occupation and the number of occupied sites in
+// the surrounding 5x5 block, every event changes the rates of 25 sites, reports the time per
+// event when the rates are modified one by one and when they are modified in a batch
+
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <string>
+#include <chrono>
+#include <trng/lcg64_shift.hpp>
+#include <trng/discrete_dist.hpp>
+
+
+class lattice_gas {
+  const int L;
+  std::vector<int> occupied, neighbors;
+  std::vector<double> rates;
+
+public:
+  explicit lattice_gas(int L)
+      : L{L}, occupied(L * L, 0), neighbors(L * L, 0), rates(2 * 25) {
+    // adsorption becomes faster and desorption slower with the number of occupied neighbors
+    for (int n{0}; n < 25; ++n) {
+      rates[n] = std::exp(0.125 * n);
+      rates[25 + n] = std::exp(-0.25 * n);
+    }
+  }
+  int size() const { return L * L; }
+  double rate(int i) const { return rates[25 * occupied[i] + neighbors[i]]; }
+  // flips site i and calls f for each site whose rate changed
+  template<typename F>
+  void flip(int i, F f) {
+    occupied[i] = 1 - occupied[i];
+    const int delta{2 * occupied[i] - 1};
+    const int x{i % L}, y{i / L};
+    for (int dy{-2}; dy <= 2; ++dy)
+      for (int dx{-2}; dx <= 2; ++dx) {
+        const int j{(y + dy + L) % L * L + (x + dx + L) % L};
+        if (j != i)
+          neighbors[j] += delta;
+        f(j);
+      }
+  }
+};
+
+
+template<typename method>
+void time_kmc(int L, bool batch, const std::string &name) {
+  const long events{1000000};
+  lattice_gas gas(L);
+  std::vector<double> weights;
+  for (int i{0}; i < gas.size(); ++i)
+    weights.push_back(gas.rate(i));
+  trng::discrete_dist d(weights.begin(), weights.end(), method{});
+  trng::lcg64_shift r;
+  std::vector<std::pair<int, double>> changes;
+  long s{0};
+  const auto t0{std::chrono::high_resolution_clock::now()};
+  for (long e{0}; e < events; ++e) {
+    const int i{d(r)};
+    s += i;
+    if (batch) {
+      changes.clear();
+      gas.flip(i, [&](int j) { changes.emplace_back(j, gas.rate(j)); });
+      d.update(changes.begin(), changes.end());
+    } else
+      gas.flip(i, [&](int j) { d.param(j, gas.rate(j)); });
+  }
+  const auto t1{std::chrono::high_resolution_clock::now()};
+  std::cout << name << '\t' << 1e9 * std::chrono::duration<double>(t1 - t0).count() / events
+            << " ns/event\t(" << s % 10 << ")\n";
+}
+
+
+int main(int argc, char *argv[]) {
+  const int L{argc > 1 ? std::atoi(argv[1]) : 1024};
+  std::cout << L << " x " << L << " sites\n";
+  time_kmc<trng::sampling_method::inversion>(L, false, "binary tree, single updates");
+  time_kmc<trng::sampling_method::inversion>(L, true, "binary tree, batched updates");
+  time_kmc<trng::sampling_method::b_ary_tree>(L, false, "8-ary tree, single updates ");
+  time_kmc<trng::sampling_method::b_ary_tree>(L, true, "8-ary tree, batched updates ");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// compares the two kinds of tables for the output transformation of the yarn generators,
+// int_math::power (384 KiB) and int_math::compact_power (16 KiB), alone and interleaved
+// with random accesses into a working set that simulates the memory footprint of an
+// application, on Linux the number of L1 data cache misses is reported as well
+
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <memory>
+#include <trng/int_math.hpp>
+#include <trng/mrg3.hpp>
+#if defined __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+
+class cache_miss_counter {
+  int fd{-1};
+
+public:
+  cache_miss_counter() {
+#if defined __linux__
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8u) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+  ~cache_miss_counter() {
+#if defined __linux__
+    if (fd >= 0)
+      close(fd);
+#endif
+  }
+  cache_miss_counter(const cache_miss_counter &) = delete;
+  cache_miss_counter &operator=(const cache_miss_counter &) = delete;
+
+  void start() {
+#if defined __linux__
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+  // number of misses since start, negative if not available
+  long long stop() {
+#if defined __linux__
+    long long count{-1};
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd, &count, sizeof(count)) != sizeof(count))
+        count = -1;
+    }
+    return count;
+#else
+    return -1;
+#endif
+  }
+};
+
+
+template<typename P>
+void time_power(const P &g, const std::string &name, const std::vector<std::int32_t> &n,
+                std::size_t working_set) {
+  std::vector<std::uint32_t> work(working_set / sizeof(std::uint32_t) + 1);
+  const std::size_t mask{work.size() > 1 ? work.size() - 2 : 0};
+  cache_miss_counter counter;
+  std::uint64_t s{0};
+  counter.start();
+  const auto t0{std::chrono::high_resolution_clock::now()};
+  for (std::size_t i{0}; i < n.size(); ++i) {
+    const std::uint32_t y{static_cast<std::uint32_t>(g(n[i]))};
+    s += y;
+    if (mask > 0)
+      ++work[(y ^ (y >> 16u)) & mask];
+  }
+  const auto t1{std::chrono::high_resolution_clock::now()};
+  const long long misses{counter.stop()};
+  const double t{std::chrono::duration<double>(t1 - t0).count()};
+  std::cout << name << "  working set " << working_set / 1024 << " KiB  "
+            << 1e-6 * n.size() / t << " M/s  ";
+  if (misses >= 0)
+    std::cout << static_cast<double>(misses) / n.size() << " L1 misses/value";
+  else
+    std::cout << "L1 misses not available";
+  std::cout << "  (" << s % 10 << ")\n";
+}
+
+
+int main() {
+  constexpr std::int32_t modulus{2147483647}, gen{123567893};
+  using power_type = trng::int_math::power<modulus, gen>;
+  using compact_power_type = trng::int_math::compact_power<modulus, gen>;
+  const std::unique_ptr<power_type> g(new power_type);
+  const std::unique_ptr<compact_power_type> g_compact(new compact_power_type);
+  // exponents as they occur in yarn3
+  trng::mrg3 r;
+  std::vector<std::int32_t> n(1u << 24u);
+  r.generate(n.begin(), n.end());
+  for (auto &x : n)
+    if (x == 0)
+      x = 1;
+  for (std::size_t working_set : {0ul, 128ul * 1024, 512ul * 1024, 2048ul * 1024}) {
+    time_power(*g, "power        ", n, working_set);
+    time_power(*g_compact, "compact_power", n, working_set);
+  }
+  return EXIT_SUCCESS;
+}
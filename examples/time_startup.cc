@@ -0,0 +1,80 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// measures the start-up cost of a program that uses a yarn generator, the tables for the
+// output transformation are precomputed at build time and therefore no longer contribute
+// to the start-up time, for comparison the time for computing the tables at run time is
+// reported as well
+
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <memory>
+#include <trng/int_math.hpp>
+#include <trng/yarn3.hpp>
+
+
+int main(int argc, char *argv[]) {
+  if (argc == 2 and std::string(argv[1]) == "child") {
+    // minimal work that requires the tables of yarn3
+    trng::yarn3 r;
+    return r() == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+  const int runs{100};
+  const std::string command{std::string(argv[0]) + " child"};
+  const auto t0{std::chrono::high_resolution_clock::now()};
+  for (int i{0}; i < runs; ++i)
+    if (std::system(command.c_str()) != 0) {
+      std::cerr << "cannot run " << command << '\n';
+      return EXIT_FAILURE;
+    }
+  const auto t1{std::chrono::high_resolution_clock::now()};
+  std::cout << "process start-up and exit  "
+            << 1e3 * std::chrono::duration<double>(t1 - t0).count() / runs << " ms\n";
+
+  constexpr std::int32_t modulus{2147483647}, gen{123567893};
+  using power_type = trng::int_math::power<modulus, gen>;
+  using compact_power_type = trng::int_math::compact_power<modulus, gen>;
+  const auto t2{std::chrono::high_resolution_clock::now()};
+  const std::unique_ptr<power_type> g(new power_type);
+  const auto t3{std::chrono::high_resolution_clock::now()};
+  const std::unique_ptr<compact_power_type> g_compact(new compact_power_type);
+  const auto t4{std::chrono::high_resolution_clock::now()};
+  std::cout << "computing power tables at run time          "
+            << 1e3 * std::chrono::duration<double>(t3 - t2).count() << " ms\n"
+            << "computing compact power tables at run time  "
+            << 1e3 * std::chrono::duration<double>(t4 - t3).count() << " ms\n"
+            << "(" << (static_cast<std::uint32_t>((*g)(12345)) + static_cast<std::uint32_t>((*g_compact)(12345))) % 10 << ")\n";
+  return EXIT_SUCCESS;
+}
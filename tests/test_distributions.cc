@@ -37,6 +37,8 @@
 #include <iterator>
 #include <limits>
 #include <cmath>
+#include <cerrno>
+#include <cstdint>
 #include <numeric>
 #include <ciso646>
 #include <sstream>
@@ -46,6 +48,8 @@
 #include <trng/uniform01_dist.hpp>
 #include <trng/special_functions.hpp>
 #include <trng/lcg64_shift.hpp>
+#include <trng/mrg3.hpp>
+#include <trng/mt19937.hpp>
 #include <trng/exponential_dist.hpp>
 #include <trng/twosided_exponential_dist.hpp>
 #include <trng/normal_dist.hpp>
@@ -74,6 +78,7 @@
 #include <trng/poisson_dist.hpp>
 #include <trng/zero_truncated_poisson_dist.hpp>
 #include <trng/discrete_dist.hpp>
+#include <trng/fast_discrete_dist.hpp>
 
 
 // integration by Simpson rule
@@ -241,7 +246,7 @@ void discrete_dist_test_pdf(dist &d) {
 
 
 // failure of the chi2 test does not necessarily imply an error, may happen just by chance
-template<typename dist>
+template<typename dist, typename engine = trng::lcg64_shift>
 void discrete_dist_test_chi2_test(dist &d) {
   using result_type = typename dist::result_type;
   std::vector<double> p;
@@ -260,7 +265,7 @@ void discrete_dist_test_chi2_test(dist &d) {
   const int bins{static_cast<int>(p.size())};
   const int N{10000};
   std::vector<int> count(bins, 0);
-  trng::lcg64_shift R(100ull);
+  engine R(100ull);
   for (int i{0}; i < N; ++i) {
     const result_type x{d(R) - d.min()};
     int bin{std::min(x, bins - 1)};
@@ -337,6 +342,11 @@ TEMPLATE_TEST_CASE("continuous distributions", "", float, double, long double) {
     continuous_dist_test(d);
   }
 
+  SECTION("normal_dist, rejection") {
+    trng::normal_dist<TestType, trng::sampling_method::rejection> d(TestType(5), TestType(2));
+    continuous_dist_test(d);
+  }
+
   SECTION("truncated_normal_dist") {
     trng::truncated_normal_dist<TestType> d(TestType(5), TestType(2), TestType(2), TestType(6));
     continuous_dist_test(d);
@@ -392,16 +402,44 @@ TEMPLATE_TEST_CASE("continuous distributions", "", float, double, long double) {
     continuous_dist_test(d);
   }
 
+  SECTION("gamma_dist, rejection") {
+    trng::gamma_dist<TestType, trng::sampling_method::rejection> d(TestType(5), TestType(2));
+    continuous_dist_test(d);
+  }
+
+  SECTION("gamma_dist, rejection, small shape") {
+    // shape parameters smaller than one are reduced to shape plus one
+    trng::gamma_dist<TestType, trng::sampling_method::rejection> d(TestType(3) / TestType(4),
+                                                                   TestType(2));
+    continuous_dist_test(d);
+  }
+
   SECTION("beta_dist") {
     trng::beta_dist<TestType> d(TestType(3), TestType(2));
     continuous_dist_test(d);
   }
 
+  SECTION("beta_dist, rejection") {
+    trng::beta_dist<TestType, trng::sampling_method::rejection> d(TestType(3), TestType(2));
+    continuous_dist_test(d);
+  }
+
+  SECTION("beta_dist, rejection, small shape") {
+    trng::beta_dist<TestType, trng::sampling_method::rejection> d(TestType(3) / TestType(4),
+                                                                  TestType(2));
+    continuous_dist_test(d);
+  }
+
   SECTION("chi_square_dist") {
     trng::chi_square_dist<TestType> d(38);
     continuous_dist_test(d);
   }
 
+  SECTION("chi_square_dist, rejection") {
+    trng::chi_square_dist<TestType, trng::sampling_method::rejection> d(38);
+    continuous_dist_test(d);
+  }
+
   SECTION("student_t_dist") {
     trng::student_t_dist<TestType> d(10);
     continuous_dist_test(d);
@@ -430,11 +468,29 @@ TEMPLATE_TEST_CASE("discrete distributions", "", float, double, long double) {
     discrete_dist_test(d);
   }
 
+  SECTION("uniform_int_dist, rejection") {
+    trng::uniform_int_dist d(8, 100, trng::sampling_method::rejection{});
+    discrete_dist_test(d);
+    // engine with 32 bits and engine with 31 bits per call
+    discrete_dist_test_chi2_test<trng::uniform_int_dist, trng::mt19937>(d);
+    discrete_dist_test_chi2_test<trng::uniform_int_dist, trng::mrg3>(d);
+  }
+
   SECTION("binomial_dist") {
     trng::binomial_dist d(0.4, 20);
     discrete_dist_test(d);
   }
 
+  SECTION("binomial_dist, rejection") {
+    trng::binomial_dist d(0.4, 200, trng::sampling_method::rejection{});
+    discrete_dist_test(d);
+  }
+
+  SECTION("binomial_dist, rejection, small n p") {
+    trng::binomial_dist d(0.9, 20, trng::sampling_method::rejection{});
+    discrete_dist_test(d);
+  }
+
   SECTION("negative_binomial_dist") {
     trng::negative_binomial_dist d(0.4, 20);
     discrete_dist_test(d);
@@ -455,6 +511,11 @@ TEMPLATE_TEST_CASE("discrete distributions", "", float, double, long double) {
     discrete_dist_test(d);
   }
 
+  SECTION("poisson_dist, rejection") {
+    trng::poisson_dist d(42.5, trng::sampling_method::rejection{});
+    discrete_dist_test(d);
+  }
+
   SECTION("zero_truncated_poisson_dist") {
     trng::zero_truncated_poisson_dist d(2.125);
     discrete_dist_test(d);
@@ -465,4 +526,283 @@ TEMPLATE_TEST_CASE("discrete distributions", "", float, double, long double) {
     trng::discrete_dist d(p.begin(), p.end());
     discrete_dist_test(d);
   }
+
+  SECTION("fast_discrete_dist") {
+    std::vector<int> p{1, 2, 3, 4, 0, 5, 4, 3, 2, 1};
+    trng::fast_discrete_dist d(p.begin(), p.end());
+    discrete_dist_test(d);
+    // engine with less than 64 bits per call
+    discrete_dist_test_chi2_test<trng::fast_discrete_dist, trng::mrg3>(d);
+  }
+
+  SECTION("discrete_dist, b-ary tree") {
+    std::vector<int> p;
+    for (int i{0}; i < 100; ++i)
+      p.push_back(i % 10 + 1);
+    trng::discrete_dist d(p.begin(), p.end(), trng::sampling_method::b_ary_tree{});
+    d.param(17, 0);
+    d.param(50, 20);
+    discrete_dist_test(d);
+  }
+}
+
+
+TEST_CASE("discrete lookup with guide table") {
+  // cumulative distribution with flat parts and jumps, as in the tables of discrete
+  // distributions
+  std::vector<double> P;
+  for (int i{0}; i < 1000; ++i) {
+    const double p{i < 10 ? 0.0 : (i % 7 == 0 ? 3.0 : 1.0) * (i % 31 == 0 ? 0.0 : 1.0)};
+    P.push_back((P.empty() ? 0.0 : P.back()) + p);
+  }
+  for (auto &p : P)
+    p /= P.back();
+  const trng::utility::discrete_guide_type guide{
+      trng::utility::discrete_guide(P.begin(), P.end())};
+  REQUIRE(guide.size() == 512);
+  std::vector<double> x;
+  trng::lcg64_shift R;
+  for (int i{0}; i < 100000; ++i)
+    x.push_back(trng::utility::uniformco<double>(R));
+  for (std::size_t j{0}; j < guide.size(); ++j)
+    x.push_back(static_cast<double>(j) / static_cast<double>(guide.size()));
+  x.insert(x.end(), P.begin(), P.end());
+  for (const double y : x) {
+    const std::size_t i1{trng::utility::discrete(y, P.begin(), P.end())};
+    const std::size_t i2{trng::utility::discrete(y, P.begin(), P.end(), guide)};
+    if (i1 != i2)  // switch into REQUIRE macro in failure case only, for performance reasons
+      REQUIRE(i1 == i2);
+  }
+}
+
+
+TEST_CASE("discrete_dist batched updates") {
+  std::vector<double> p;
+  for (int i{0}; i < 1000; ++i)
+    p.push_back(i % 13 + 0.5);
+  for (const bool b_ary_tree : {false, true}) {
+    trng::discrete_dist d1{
+        b_ary_tree ? trng::discrete_dist(p.begin(), p.end(), trng::sampling_method::b_ary_tree{})
+                   : trng::discrete_dist(p.begin(), p.end())};
+    trng::discrete_dist d2{d1}, d3{d1};
+    // contiguous range of weights
+    const std::vector<double> q{1, 0, 2.5, 3, 0.25, 7, 1, 1, 9, 2, 0.125};
+    d1.update(337, q.begin(), q.end());
+    for (std::size_t i{0}; i < q.size(); ++i)
+      d2.param(337 + static_cast<int>(i), q[i]);
+    REQUIRE(d1 == d2);
+    // unsorted list of (index, weight) pairs with repeated indices
+    const std::vector<std::pair<int, double>> r{{5, 1.5}, {999, 0}, {0, 4}, {17, 3}, {6, 2},
+                                                {500, 8}, {17, 1}, {501, 0.5}};
+    d1.update(r.begin(), r.end());
+    for (const auto &x : r)
+      d2.param(x.first, x.second);
+    REQUIRE(d1 == d2);
+    // cumulative density function
+    for (int i{0}; i < 1000; ++i) {
+      double s{0};
+      for (int j{0}; j <= i; ++j)
+        s += d1.pdf(j);
+      if (std::abs(d1.cdf(i) - s) > 32 * std::numeric_limits<double>::epsilon())
+        REQUIRE(std::abs(d1.cdf(i) - s) <= 32 * std::numeric_limits<double>::epsilon());
+    }
+    REQUIRE(d1.cdf(-1) == 0);
+    REQUIRE(d1.cdf(1000) == 1);
+    REQUIRE(d1 != d3);
+  }
+}
+
+
+TEST_CASE("fast_discrete_dist rebuild") {
+  // several chunks of the construction, light buckets in the lower half and heavy buckets in
+  // the upper half, such that most buckets are paired across chunks
+  const int N{300000};
+  std::vector<double> p1, p2;
+  for (int i{0}; i < N; ++i) {
+    p1.push_back(i % 17 + 1.0);
+    p2.push_back(i < N / 2 ? 1.0 + (i % 3) : 4.0 + (i % 5));
+  }
+  trng::fast_discrete_dist d1(p1.begin(), p1.end());
+  const trng::fast_discrete_dist d2(p2.begin(), p2.end());
+  d1.param(p2.begin(), p2.end());
+  REQUIRE(d1 == d2);
+  const int bins{64}, samples{1000000};
+  std::vector<double> p(bins, 0.0);
+  for (int i{0}; i < N; ++i)
+    p[static_cast<std::size_t>(i) * bins / N] += d2.pdf(i);
+  std::vector<int> count(bins, 0);
+  trng::lcg64_shift R1, R2;
+  trng::fast_discrete_dist d3(d2);
+  for (int i{0}; i < samples; ++i) {
+    // tables of rebuilt and newly constructed distributions are identical
+    const int x{d1(R1)}, y{d3(R2)};
+    if (x != y)
+      REQUIRE(x == y);
+    ++count[static_cast<std::size_t>(x) * bins / N];
+  }
+  const double c2_p{chi_percentil(p, count)};
+  REQUIRE((0.01 < c2_p and c2_p < 0.99));
+}
+
+
+template<typename dist>
+void discrete_dist_test_icdf(const dist &d) {
+  const double eps{64 * std::numeric_limits<double>::epsilon()};
+  trng::lcg64_shift R;
+  std::vector<double> p_values{0.0, 1.0};
+  for (int i{0}; i < 10000; ++i)
+    p_values.push_back(trng::utility::uniformco<double>(R));
+  for (int x{d.min()}; x <= d.max(); x += 7)
+    p_values.push_back(d.cdf(x));
+  for (const double p : p_values) {
+    const int x{d.icdf(p)};
+    const bool ok{d.min() <= x and x <= d.max() and d.cdf(x) >= p - eps and
+                  (x == d.min() or d.cdf(x - 1) < p + eps)};
+    if (not ok)  // switch into REQUIRE macro in failure case only, for performance reasons
+      REQUIRE(ok);
+  }
+  errno = 0;
+  REQUIRE(d.icdf(1.5) == -1);
+  REQUIRE(errno == EDOM);
+}
+
+
+TEST_CASE("discrete icdf") {
+  std::vector<double> p;
+  for (int i{0}; i < 1000; ++i)
+    p.push_back(i % 11 == 0 ? 0.0 : i % 13 + 0.25);
+  SECTION("discrete_dist") {
+    trng::discrete_dist d(p.begin(), p.end());
+    d.param(500, 7.5);
+    discrete_dist_test_icdf(d);
+  }
+  SECTION("discrete_dist, b-ary tree") {
+    trng::discrete_dist d(p.begin(), p.end(), trng::sampling_method::b_ary_tree{});
+    d.param(500, 7.5);
+    discrete_dist_test_icdf(d);
+  }
+  SECTION("fast_discrete_dist") {
+    trng::fast_discrete_dist d(p.begin(), p.end());
+    discrete_dist_test_icdf(d);
+    // cached cumulative probabilities are recomputed for new parameters
+    p[0] = 100;
+    d.param(p.begin(), p.end());
+    REQUIRE(d.cdf(0) == d.pdf(0));
+    discrete_dist_test_icdf(d);
+    // copies compute their own cumulative probabilities, moved objects take them over
+    const trng::fast_discrete_dist d_copy(d);
+    REQUIRE(d_copy.cdf(500) == d.cdf(500));
+    trng::fast_discrete_dist d_move(std::move(d));
+    REQUIRE(d_move.cdf(500) == d_copy.cdf(500));
+    d = d_copy;
+    REQUIRE(d.icdf(0.5) == d_copy.icdf(0.5));
+  }
+}
+
+
+template<typename R>
+void bernoulli_dist_test_bits(double p) {
+  trng::bernoulli_dist<int> d(p, 1, 0);
+  R r;
+  const int n{20000};
+  std::vector<int> count(64, 0);
+  for (int i{0}; i < n; ++i) {
+    const std::uint64_t x{d.bits(r)};
+    for (int j{0}; j < 64; ++j)
+      count[j] += (x >> j) & 1u;
+  }
+  // all 64 samples of a word follow the Bernoulli distribution
+  const double sigma{std::sqrt(n * p * (1 - p))};
+  for (int j{0}; j < 64; ++j)
+    REQUIRE(std::abs(count[j] - n * p) < 5 * sigma);
+}
+
+
+// engine that counts the number of random numbers that it generates
+template<typename R>
+class counting_engine {
+public:
+  using result_type = typename R::result_type;
+  static constexpr result_type min() { return R::min(); }
+  static constexpr result_type max() { return R::max(); }
+  result_type operator()() {
+    ++calls;
+    return r();
+  }
+  long calls{0};
+
+private:
+  R r;
+};
+
+
+// range with d = 3 * 2^29, the multiply-shift method rejects 2^32 mod d = 2^30 of the 2^32
+// values of a 32-bit engine, i.e., a quarter of all draws
+template<typename engine>
+void uniform_int_dist_test_wide_range() {
+  const int a{0}, b{3 << 29}, bins{16};
+  trng::uniform_int_dist d(a, b, trng::sampling_method::rejection{});
+  counting_engine<engine> R;
+  const long N{100000};
+  std::vector<int> count(bins, 0), count_mod_48(48, 0);
+  for (long i{0}; i < N; ++i) {
+    const int x{d(R)};
+    if (not(a <= x and x < b))  // switch into REQUIRE macro in failure case only
+      REQUIRE((a <= x and x < b));
+    ++count[x / (b / bins)];
+    ++count_mod_48[x % 48];
+  }
+  const std::vector<double> p(bins, 1.0 / bins);
+  const double c2_p{chi_percentil(p, count)};
+  REQUIRE((0.01 < c2_p and c2_p < 0.99));
+  // without rejection, residues 0 and 1 modulo 3 would be hit with probability 3/8 each
+  const std::vector<double> p_mod_48(48, 1.0 / 48.0);
+  const double c2_p_mod_48{chi_percentil(p_mod_48, count_mod_48)};
+  REQUIRE((0.01 < c2_p_mod_48 and c2_p_mod_48 < 0.99));
+  // expected number of calls per sample is 4 / 3 for 32-bit engines and 1 for 64-bit engines
+  const double calls_per_sample{static_cast<double>(R.calls) / static_cast<double>(N)};
+  if (trng::utility::engine_bits<engine>::value == 32)
+    REQUIRE(std::abs(calls_per_sample - 4.0 / 3.0) < 0.01);
+  else
+    REQUIRE(calls_per_sample < 1.0001);
+}
+
+
+TEST_CASE("uniform_int_dist, rejection, wide range") {
+  SECTION("32-bit engine") {
+    uniform_int_dist_test_wide_range<trng::mt19937>();
+  }
+  SECTION("64-bit engine") {
+    uniform_int_dist_test_wide_range<trng::lcg64_shift>();
+  }
+}
+
+
+TEST_CASE("bernoulli_dist bits") {
+  SECTION("64-bit engine") {
+    bernoulli_dist_test_bits<trng::lcg64_shift>(0.3);
+    bernoulli_dist_test_bits<trng::lcg64_shift>(0.875);
+  }
+  SECTION("32-bit engine") {
+    bernoulli_dist_test_bits<trng::mt19937>(0.3);
+  }
+  SECTION("31-bit engine") {
+    bernoulli_dist_test_bits<trng::mrg3>(0.3);
+  }
+  SECTION("exact for dyadic p") {
+    // p = 3/8 needs at most three random words
+    trng::bernoulli_dist<int> d(0.375, 1, 0);
+    trng::lcg64_shift r1, r2;
+    for (int i{0}; i < 1000; ++i) {
+      d.bits(r1);
+      int calls{0};
+      while (r1 != r2 and calls < 4) {
+        r2();
+        ++calls;
+      }
+      REQUIRE((r1 == r2 and calls <= 3));
+    }
+    REQUIRE(trng::bernoulli_dist<int>(0.0, 1, 0).bits(r1) == 0);
+    REQUIRE(trng::bernoulli_dist<int>(1.0, 1, 0).bits(r1) == ~std::uint64_t(0));
+  }
 }
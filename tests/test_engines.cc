@@ -38,12 +38,14 @@
 #include <string>
 #include <sstream>
 #include <tuple>
+#include <type_traits>
 #include <ciso646>
 
 #include <trng/lcg64.hpp>
 #include <trng/lcg64_shift.hpp>
 #include <trng/lcg64_count_shift.hpp>
 #include <trng/count128_lcg_shift.hpp>
+#include <trng/philox4x32.hpp>
 #include <trng/mrg2.hpp>
 #include <trng/mrg3.hpp>
 #include <trng/mrg3s.hpp>
@@ -63,6 +65,7 @@
 #include <trng/mt19937.hpp>
 #include <trng/mt19937_64.hpp>
 #include <trng/xoshiro256plus.hpp>
+#include <trng/simd_mrg.hpp>
 
 
 template<typename R>
@@ -150,7 +153,7 @@ void test_ranges_impl() {
 
 TEMPLATE_TEST_CASE("engines", "",                                            //
                    trng::lcg64, trng::lcg64_shift, trng::lcg64_count_shift,  //
-                   trng::count128_lcg_shift,                                 //
+                   trng::count128_lcg_shift, trng::philox4x32,               //
                    trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
                    trng::mrg5s,  //
                    trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4, trng::yarn5,
@@ -180,6 +183,22 @@ TEMPLATE_TEST_CASE("engines", "",                                            //
     REQUIRE(std::get<0>(v) == std::get<1>(v));
   }
 
+  SECTION("generate") {
+    // two engines with equal state
+    TestType r1, r2;
+    advance_engine(r1, r2, 271828l);
+    // bulk generation in chunks of various sizes must yield the same values as repeated
+    // calls of operator()
+    for (const long N : {0l, 1l, 2l, 3l, 100l, 623l, 1000l, 5000l}) {
+      std::vector<typename TestType::result_type> v1(N), v2;
+      r1.generate(v1.begin(), v1.end());
+      for (long i{0}; i < N; ++i)
+        v2.push_back(r2());
+      REQUIRE(v1 == v2);
+      REQUIRE(r1 == r2);
+    }
+  }
+
   SECTION("state_io") {
     // two engines with equal state
     GIVEN("two engines with equal state") {
@@ -288,7 +307,7 @@ TEMPLATE_TEST_CASE("engines", "",                                            //
 
 TEMPLATE_TEST_CASE("parallel engines", "",                                   //
                    trng::lcg64, trng::lcg64_shift, trng::lcg64_count_shift,  //
-                   trng::count128_lcg_shift,                                 //
+                   trng::count128_lcg_shift, trng::philox4x32,               //
                    trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
                    trng::mrg5s,  //
                    trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4, trng::yarn5,
@@ -327,4 +346,183 @@ TEMPLATE_TEST_CASE("parallel engines", "",                                   //
       }
     }
   }
+
+  SECTION("trivially copyable") {
+    // engines are passed by value to CUDA kernels
+    REQUIRE(std::is_trivially_copyable<TestType>::value);
+  }
+
+  SECTION("jump with many parameter sets") {
+    // more parameter sets than fit into the cache of jump tables of the MRG and YARN engines
+    for (unsigned int s{2}; s < 1200; ++s) {
+      TestType r1, r2;
+      r1.split(s, 1);
+      r2.split(s, 1);
+      r1.jump2(4);
+      for (int j{0}; j < 16; ++j)
+        r2();
+      REQUIRE(r1 == r2);
+    }
+  }
+
+  SECTION("jump after split") {
+    // two engines with equal state
+    GIVEN("two engines with equal state that have jumped before") {
+      TestType r1, r2;
+      r1.jump(1000);
+      r2.jump(1000);
+      const long i{GENERATE(range(0l, 12l))};
+      const long n{1l << i};
+      WHEN("split both, jump ahead one, advance other") {
+        r1.split(3, 1);
+        r2.split(3, 1);
+        r1.jump2(i);
+        for (long j{0l}; j < n; ++j)
+          r2();
+        THEN("both engines have equal state") { REQUIRE(r1 == r2); }
+      }
+    }
+  }
+}
+
+
+TEST_CASE("philox4x32 full period jump") {
+  GIVEN("two engines with equal state") {
+    trng::philox4x32 r1, r2;
+    advance_engine(r1, r2, 271l);
+    const unsigned int s{GENERATE(128u, 129u, 200u, 255u, 256u)};
+    WHEN("jump ahead one by a multiple of the period 2^128") {
+      r1.jump2(s);
+      THEN("both engines have equal state and generate same values") {
+        REQUIRE(r1 == r2);
+        const auto v{generate_list(r1, r2, 100)};
+        REQUIRE(std::get<0>(v) == std::get<1>(v));
+      }
+    }
+  }
+}
+
+
+TEST_CASE("philox4x32 known answers") {
+  // test vectors of the Random123 library, the engine's state holds four times the counter
+  const std::vector<std::tuple<std::string, std::vector<trng::philox4x32::result_type>>>
+      known_answers{
+          {"[philox4x32 (0 0 1) (0)]", {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}},
+          {"[philox4x32 (2752067618 698298832 1) (18286236424164840408123530530420271648)]",
+           {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}}};
+  for (const auto &known_answer : known_answers) {
+    trng::philox4x32 r;
+    std::stringstream str(std::get<0>(known_answer));
+    str >> r;
+    REQUIRE(str.good());
+    std::vector<trng::philox4x32::result_type> v;
+    for (int i{0}; i < 4; ++i)
+      v.push_back(r());
+    REQUIRE(v == std::get<1>(known_answer));
+  }
+}
+
+
+TEMPLATE_TEST_CASE("jumpable engines", "",  //
+                   trng::lagfib2xor_19937_64, trng::lagfib4xor_19937_64,    //
+                   trng::lagfib2plus_9689_64, trng::lagfib4plus_9689_64,  //
+                   trng::mt19937, trng::mt19937_64) {
+  SECTION("jump2") {
+    // two engines with equal state
+    GIVEN("two engines with equal state") {
+      TestType r1, r2;
+      const long i{GENERATE(range(0l, 20l))};
+      const long n{1l << i};
+      WHEN("jump ahead one, advance other") {
+        r1.jump2(i);
+        for (long j{0l}; j < n; ++j)
+          r2();
+        THEN("both engines have equal state") { REQUIRE(r1 == r2); }
+      }
+    }
+  }
+
+  SECTION("far jump2") {
+    // three engines with equal state, not at the beginning of a block of values
+    GIVEN("three engines with equal state") {
+      TestType r1, r2, r3;
+      advance_engine(r1, r2, 271l);
+      r3 = r1;
+      const unsigned int i{GENERATE(30u, 40u, 63u, 64u)};
+      WHEN("jump ahead at once and in parts") {
+        r1.jump2(i + 1);
+        r2.jump2(i);
+        r2.jump2(i);
+        if (i < 64) {
+          r3.jump(1ull << 30u);
+          r3.jump((1ull << i) - (1ull << 30u));
+          r3.jump2(i);
+        } else
+          r3 = r2;
+        THEN("all engines have equal state and generate same values") {
+          REQUIRE(r1 == r2);
+          REQUIRE(r1 == r3);
+          const auto v{generate_list(r1, r3, 1000)};
+          REQUIRE(std::get<0>(v) == std::get<1>(v));
+        }
+      }
+    }
+  }
+}
+
+
+TEMPLATE_TEST_CASE("long-lag engines", "",  //
+                   trng::lagfib2xor_19937_64, trng::lagfib4xor_19937_64, trng::Ziff_32,  //
+                   trng::lagfib2plus_9689_64, trng::lagfib4plus_9689_64,                 //
+                   trng::mt19937, trng::mt19937_64) {
+  GIVEN("three engines with equal state") {
+    TestType r1, r2, r3;
+    WHEN("jump far ahead at once, in two parts and jump ahead by less and advance") {
+      const unsigned long long n{1ull << 50u};
+      const unsigned long long m{271828};
+      r1.discard(n);
+      r2.discard(n / 2);
+      r2.discard(n / 2);
+      r3.discard(n - m);
+      advance_engine(r3, m);
+      THEN("all engines have equal state") {
+        REQUIRE(r1 == r2);
+        REQUIRE(r1 == r3);
+      }
+    }
+  }
+}
+
+
+TEMPLATE_TEST_CASE("simd engines", "",  //
+                   trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
+                   trng::mrg5s,  //
+                   trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4, trng::yarn5,
+                   trng::yarn5s) {
+  GIVEN("an engine and multi-stream engines built from it") {
+    TestType r;
+    advance_engine(r, 271828l);
+    trng::simd_mrg<TestType, 1> s1(r);
+    trng::simd_mrg<TestType, 4> s4(r);
+    trng::simd_mrg<TestType, 8> s8(r);
+    trng::simd_mrg<TestType, 16> s16(r);
+    THEN("interleaved sub-streams yield the same values as the engine") {
+      const long N{1000};
+      std::vector<typename TestType::result_type> v(N), v1(N), v4, v8(N), v16(N);
+      r.generate(v.begin(), v.end());
+      s1.generate(v1.begin(), v1.end());
+      for (long i{0}; i < N; ++i)
+        v4.push_back(s4());
+      // start and end within a block of values
+      s8.generate(v8.begin(), v8.begin() + 3);
+      s8.generate(v8.begin() + 3, v8.end());
+      for (long i{0}; i < 5; ++i)
+        v16[i] = s16();
+      s16.generate(v16.begin() + 5, v16.end());
+      REQUIRE(v1 == v);
+      REQUIRE(v4 == v);
+      REQUIRE(v8 == v);
+      REQUIRE(v16 == v);
+    }
+  }
 }
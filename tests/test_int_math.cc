@@ -31,6 +31,8 @@
 // OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <array>
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <tuple>
 #include <utility>
@@ -73,6 +75,13 @@ TEST_CASE("integer math") {
     REQUIRE(trng::int_math::mask(trng::int32_t(0x7fffffff)) == 0x7fffffff);
     REQUIRE(trng::int_math::mask(trng::uint32_t(0xffffffffu)) == 0xffffffffu);
   }
+
+  SECTION("popcount") {
+    REQUIRE(trng::int_math::popcount(0) == 0);
+    REQUIRE(trng::int_math::popcount(0x8000000000000001ull) == 2);
+    REQUIRE(trng::int_math::popcount(0xf0f0f0f0f0f0f0f0ull) == 32);
+    REQUIRE(trng::int_math::popcount(~0ull) == 64);
+  }
 }
 
 
@@ -193,3 +202,25 @@ TEST_CASE("modulo inverse") {
     REQUIRE_THROWS_AS(trng::int_math::modulo_inverse(100, m), std::exception);
   }
 }
+
+
+TEST_CASE("power tables") {
+  // both kinds of tables must yield b^n mod m for the moduli and generators of the yarn
+  // generators
+  constexpr trng::int32_t m{2147462579}, b{1616076847};
+  const std::unique_ptr<trng::int_math::power<m, b>> g(new trng::int_math::power<m, b>);
+  const std::unique_ptr<trng::int_math::compact_power<m, b>> g_compact(
+      new trng::int_math::compact_power<m, b>);
+  trng::int64_t p{1};
+  for (trng::int32_t n{0}; n < 0x30000; ++n) {
+    REQUIRE((*g)(n) == p);
+    REQUIRE((*g_compact)(n) == p);
+    p = p * b % m;
+  }
+  std::uint64_t x{1};
+  for (int i{0}; i < 10000; ++i) {
+    x = 6364136223846793005ull * x + 1442695040888963407ull;
+    const trng::int32_t n{static_cast<trng::int32_t>((x >> 33u) % (m - 1))};
+    REQUIRE((*g)(n) == (*g_compact)(n));
+  }
+}
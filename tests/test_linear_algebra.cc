@@ -135,4 +135,124 @@ TEST_CASE("GF(2)") {
     auto A_8_2{trng::power(A, 8)};
     REQUIRE(A_8_2 == A_8);
   }
+
+  SECTION("bit-packed matrix operations") {
+    // compare bit-packed arithmetic with integer arithmetic modulo 2, dimension is
+    // deliberately not a multiple of the word size
+    const std::size_t n{100};
+    auto bit_a = [](std::size_t i, std::size_t j) {
+      return (7 * i + 3 * j * j + i * j) % 5 < 2;
+    };
+    auto bit_b = [](std::size_t i, std::size_t j) { return (i * i + j * 11 + 1) % 3 == 0; };
+    auto bit_v = [](std::size_t i) { return i % 3 != 1; };
+    const trng::matrix<trng::GF2, n> A(
+        [&](std::size_t i, std::size_t j) { return trng::GF2(bit_a(i, j)); });
+    const trng::matrix<trng::GF2, n> B(
+        [&](std::size_t i, std::size_t j) { return trng::GF2(bit_b(i, j)); });
+    const trng::vector<trng::GF2, n> v([&](std::size_t i) { return trng::GF2(bit_v(i)); });
+    const trng::matrix<int, n> A_int(
+        [&](std::size_t i, std::size_t j) { return static_cast<int>(bit_a(i, j)); });
+    const trng::matrix<int, n> B_int(
+        [&](std::size_t i, std::size_t j) { return static_cast<int>(bit_b(i, j)); });
+    const trng::vector<int, n> v_int([&](std::size_t i) { return static_cast<int>(bit_v(i)); });
+    const auto AB{A * B};
+    const auto AB_int{A_int * B_int};
+    const auto Av{A * v};
+    const auto Av_int{A_int * v_int};
+    const auto A_plus_B{A + B};
+    for (std::size_t i{0}; i < n; ++i) {
+      REQUIRE(static_cast<bool>(Av(i)) == (Av_int(i) % 2 == 1));
+      for (std::size_t j{0}; j < n; ++j) {
+        REQUIRE(static_cast<bool>(AB(i, j)) == (AB_int(i, j) % 2 == 1));
+        REQUIRE(static_cast<bool>(A_plus_B(i, j)) == (bit_a(i, j) != bit_b(i, j)));
+      }
+    }
+  }
+
+  SECTION("polynomial power") {
+    // compare x^n modulo p(x) = x^130 + x^67 + x^2 + 1 with repeated multiplication by x,
+    // using one coefficient per element
+    const unsigned int degree{130};
+    const std::vector<unsigned int> exponents{67, 2, 0};
+    const trng::GF2_polynomial_ring ring(degree, exponents);
+    std::vector<bool> q(degree);
+    q[0] = true;
+    for (unsigned long long n{1}; n <= 3000; ++n) {
+      const bool carry{q[degree - 1]};
+      for (unsigned int i{degree - 1}; i > 0; --i)
+        q[i] = q[i - 1];
+      q[0] = false;
+      if (carry)
+        for (auto e : exponents)
+          q[e] = not q[e];
+      const auto x_n{ring.power(n)};
+      for (unsigned int i{0}; i < degree; ++i)
+        REQUIRE(trng::GF2_polynomial_ring::coefficient(x_n, i) == q[i]);
+    }
+  }
+
+  SECTION("dense polynomial modulus and minimal polynomial") {
+    // the recurrence s_{k + 130} = s_{k + 67} + s_{k + 2} + s_k has the characteristic
+    // polynomial p(x) = x^130 + x^67 + x^2 + 1, its output's minimal polynomial must divide
+    // p and reproduce the sequence, a dense representation of p must give the same residues
+    const unsigned int degree{130};
+    const std::vector<unsigned int> exponents{67, 2, 0};
+    const trng::GF2_polynomial_ring sparse_ring(degree, exponents);
+    trng::GF2_polynomial_ring::polynomial_type p(3);
+    p[degree / 64] |= 1ull << (degree % 64);
+    for (auto e : exponents)
+      p[e / 64] |= 1ull << (e % 64);
+    const trng::GF2_polynomial_ring dense_ring(p);
+    REQUIRE(dense_ring.get_degree() == degree);
+    for (unsigned long long n : {1ull, 129ull, 130ull, 131ull, 1000ull, 123456789ull}) {
+      auto x_n{dense_ring.power(n)};
+      REQUIRE(x_n == sparse_ring.power(n));
+      dense_ring.times_x(x_n);
+      dense_ring.times_x_inverse(x_n);
+      REQUIRE(x_n == sparse_ring.power(n));
+    }
+    const std::size_t n{1000};
+    std::vector<bool> seq(n);
+    for (std::size_t k{0}; k < degree; ++k)
+      seq[k] = (k * k + 3 * k) % 7 < 3;
+    for (std::size_t k{degree}; k < n; ++k)
+      seq[k] = seq[k - degree + 67] != (seq[k - degree + 2] != seq[k - degree]);
+    trng::GF2_polynomial_ring::polynomial_type s(n / 64 + 1);
+    for (std::size_t k{0}; k < n; ++k)
+      if (seq[k])
+        s[k / 64] |= 1ull << (k % 64);
+    const trng::GF2_polynomial_ring ring(trng::GF2_minimal_polynomial(s, n));
+    const unsigned int L{ring.get_degree()};
+    REQUIRE((L > 0 and L <= degree));
+    // x^L modulo the minimal polynomial yields the coefficients of the recurrence
+    const auto c{ring.power(L)};
+    for (std::size_t k{L}; k < n; ++k) {
+      bool x{false};
+      for (std::size_t i{0}; i < L; ++i)
+        if (trng::GF2_polynomial_ring::coefficient(c, i))
+          x = x != seq[k - L + i];
+      REQUIRE(x == seq[k]);
+    }
+  }
+
+  SECTION("polynomial power modulo 2^w") {
+    // compare x^n modulo p(x) = x^200 - x^111 - x^3 - 1 with repeated multiplication by x,
+    // coefficients are taken modulo 2^32, degree is large enough to exercise Karatsuba
+    // squaring
+    const unsigned int degree{200};
+    const std::vector<unsigned int> exponents{111, 3, 0};
+    const trng::polynomial_ring<std::uint32_t> ring(degree, exponents);
+    std::vector<std::uint32_t> q(degree);
+    q[0] = 1;
+    for (unsigned long long n{1}; n <= 3000; ++n) {
+      const std::uint32_t carry{q[degree - 1]};
+      for (unsigned int i{degree - 1}; i > 0; --i)
+        q[i] = q[i - 1];
+      q[0] = 0;
+      for (auto e : exponents)
+        q[e] += carry;
+      if (n % 7 == 0 or n > 2900)
+        REQUIRE(ring.power(n) == q);
+    }
+  }
 }
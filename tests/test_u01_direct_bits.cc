@@ -0,0 +1,182 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <catch2/catch.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <trng/lcg64_shift.hpp>
+#include <trng/mt19937.hpp>
+#include <trng/mrg3.hpp>
+#include <trng/yarn3.hpp>
+#include <trng/uniformxx.hpp>
+
+// this file is compiled into its own test executable with TRNG_U01_DIRECT_BITS defined, such
+// that all instantiations of u01xx_traits within the executable use the direct construction
+#if !(defined TRNG_U01_DIRECT_BITS)
+#error "TRNG_U01_DIRECT_BITS must be defined"
+#endif
+
+
+// engine that returns always the same value, gives the extreme values of the construction
+template<typename T, T min_v, T max_v>
+class constant_engine {
+public:
+  using result_type = T;
+  static constexpr result_type min() { return min_v; }
+  static constexpr result_type max() { return max_v; }
+  explicit constant_engine(result_type x) : x{x} {}
+  result_type operator()() { return x; }
+
+private:
+  result_type x;
+};
+
+using constant_engine_64 = constant_engine<std::uint64_t, 0, UINT64_MAX>;
+using constant_engine_32 = constant_engine<std::uint32_t, 0, UINT32_MAX>;
+// same range as the MRG and YARN engines with modulus 2^31 - 1
+using constant_engine_31 = constant_engine<std::int32_t, 0, 2147483646>;
+
+
+template<typename R, typename T>
+void u01_direct_bits_test_range(R &r) {
+  for (int i{0}; i < 100000; ++i) {
+    const T u_co{trng::utility::uniformco<T>(r)};
+    REQUIRE((u_co >= 0 and u_co < 1));
+    const T u_oc{trng::utility::uniformoc<T>(r)};
+    REQUIRE((u_oc > 0 and u_oc <= 1));
+    const T u_oo{trng::utility::uniformoo<T>(r)};
+    REQUIRE((u_oo > 0 and u_oo < 1));
+  }
+}
+
+
+TEMPLATE_TEST_CASE("u01 direct bits, extreme values", "", float, double) {
+  const int mant{std::numeric_limits<TestType>::digits - 1};
+  SECTION("64-bit engine") {
+    constant_engine_64 r_min(0), r_max(UINT64_MAX);
+    REQUIRE(trng::utility::uniformco<TestType>(r_min) == 0);
+    REQUIRE(trng::utility::uniformoc<TestType>(r_min) == 1);
+    REQUIRE(trng::utility::uniformoo<TestType>(r_min) == std::ldexp(TestType(1), -mant));
+    REQUIRE(trng::utility::uniformco<TestType>(r_max) == 1 - std::ldexp(TestType(1), -mant));
+    REQUIRE(trng::utility::uniformoc<TestType>(r_max) > 0);
+    REQUIRE(trng::utility::uniformoo<TestType>(r_max) < 1);
+  }
+  SECTION("32-bit engine") {
+    constant_engine_32 r_min(0), r_max(UINT32_MAX);
+    REQUIRE(trng::utility::uniformco<TestType>(r_min) == 0);
+    REQUIRE(trng::utility::uniformoc<TestType>(r_min) == 1);
+    REQUIRE(trng::utility::uniformoo<TestType>(r_min) > 0);
+    REQUIRE(trng::utility::uniformco<TestType>(r_max) < 1);
+    REQUIRE(trng::utility::uniformoc<TestType>(r_max) > 0);
+    REQUIRE(trng::utility::uniformoo<TestType>(r_max) < 1);
+  }
+  SECTION("31-bit engine") {
+    constant_engine_31 r_min(0), r_max(2147483646);
+    REQUIRE(trng::utility::uniformco<TestType>(r_min) == 0);
+    REQUIRE(trng::utility::uniformoc<TestType>(r_min) == 1);
+    REQUIRE(trng::utility::uniformoo<TestType>(r_min) > 0);
+    REQUIRE(trng::utility::uniformco<TestType>(r_max) < 1);
+    REQUIRE(trng::utility::uniformoc<TestType>(r_max) > 0);
+    REQUIRE(trng::utility::uniformoo<TestType>(r_max) < 1);
+    // two calls are packed into the mantissa when the full precision is requested
+    REQUIRE(trng::utility::generate_canonical<TestType, 64>(r_min) == 0);
+    REQUIRE(trng::utility::generate_canonical<TestType, 64>(r_max) < 1);
+  }
+}
+
+
+TEMPLATE_TEST_CASE("u01 direct bits, range", "", float, double) {
+  SECTION("64-bit engine") {
+    trng::lcg64_shift r;
+    u01_direct_bits_test_range<trng::lcg64_shift, TestType>(r);
+  }
+  SECTION("32-bit engine") {
+    trng::mt19937 r;
+    u01_direct_bits_test_range<trng::mt19937, TestType>(r);
+  }
+  SECTION("31-bit engines") {
+    trng::mrg3 r1;
+    u01_direct_bits_test_range<trng::mrg3, TestType>(r1);
+    trng::yarn3 r2;
+    u01_direct_bits_test_range<trng::yarn3, TestType>(r2);
+  }
+}
+
+
+TEST_CASE("u01 direct bits, mantissa") {
+  // the most significant bits of each random number form the mantissa
+  SECTION("64-bit engine") {
+    trng::lcg64_shift r1, r2;
+    for (int i{0}; i < 1000; ++i) {
+      REQUIRE(trng::utility::uniformco<double>(r1) == std::ldexp(double(r2() >> 12u), -52));
+      REQUIRE(trng::utility::uniformco<float>(r1) == std::ldexp(float(r2() >> 41u), -23));
+    }
+  }
+  SECTION("32-bit engine") {
+    trng::mt19937 r1, r2;
+    for (int i{0}; i < 1000; ++i) {
+      REQUIRE(trng::utility::uniformco<double>(r1) == std::ldexp(double(r2()), -32));
+      REQUIRE(trng::utility::uniformco<float>(r1) == std::ldexp(float(r2() >> 9u), -23));
+      // two calls with 26 bits each
+      const std::uint64_t m{std::uint64_t(r2() >> 6u) << 26u};
+      REQUIRE(trng::utility::generate_canonical<double, 53>(r1) ==
+              std::ldexp(double(m | (r2() >> 6u)), -52));
+    }
+  }
+  SECTION("31-bit engines") {
+    // all 31 bits are used for the modulus 2^31 - 1, only the largest value is missing
+    constant_engine_31 r_max(2147483646);
+    REQUIRE(trng::utility::uniformco<double>(r_max) == std::ldexp(2147483646.0, -31));
+    trng::mrg3 r1, r2;
+    trng::yarn3 r3, r4;
+    for (int i{0}; i < 1000; ++i) {
+      REQUIRE(trng::utility::uniformco<double>(r1) == std::ldexp(double(r2()), -31));
+      REQUIRE(trng::utility::uniformco<float>(r1) == std::ldexp(float(r2() >> 8u), -23));
+      REQUIRE(trng::utility::uniformco<double>(r3) == std::ldexp(double(r4()), -31));
+      // two calls with 26 bits each
+      const std::uint64_t m1{std::uint64_t(r2() >> 5u) << 26u};
+      REQUIRE(trng::utility::generate_canonical<double, 53>(r1) ==
+              std::ldexp(double(m1 | std::uint64_t(r2() >> 5u)), -52));
+      const std::uint64_t m3{std::uint64_t(r4() >> 5u) << 26u};
+      REQUIRE(trng::utility::generate_canonical<double, 53>(r3) ==
+              std::ldexp(double(m3 | std::uint64_t(r4() >> 5u)), -52));
+      // the lowest mantissa bit is set by oo
+      const double u{trng::utility::uniformoo<double>(r1)};
+      REQUIRE(u == std::ldexp(double(r2()), -31) + std::ldexp(1.0, -52));
+    }
+  }
+}
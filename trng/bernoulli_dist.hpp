@@ -37,6 +37,7 @@
 #include <trng/cuda.hpp>
 #include <trng/limits.hpp>
 #include <trng/utility.hpp>
+#include <trng/int_types.hpp>
 #include <ostream>
 #include <istream>
 #include <type_traits>
@@ -164,6 +165,16 @@ namespace trng {
       bernoulli_dist g(P);
       return g(r);
     }
+    // 64 independent samples packed into an unsigned integer, bit i is set if sample i
+    // equals head, the binary digits of p are compared digit by digit with the corresponding
+    // digits of 64 uniform random numbers, one random word for all 64 digits at a time, until
+    // all comparisons are decided, this consumes about log2(64) + 2 random words in total for
+    // general p and at most m words for p = k / 2^m, engines that do not yield 32 or 64 random
+    // bits per call fall back to 64 samples of operator()
+    template<typename R>
+    TRNG_CUDA_ENABLE uint64_t bits(R &r) {
+      return bits(r, utility::engine_bits<R>{});
+    }
     // property methods
     TRNG_CUDA_ENABLE
     T min() const {
@@ -218,6 +229,49 @@ namespace trng {
         return 1.0;
       }
     }
+
+  private:
+    template<typename R, int b>
+    TRNG_CUDA_ENABLE uint64_t bits(R &r, std::integral_constant<int, b> e) {
+      uint64_t undecided{~0ull}, heads{0};
+      double q{P.p()};
+      if (q >= 1)
+        return ~0ull;
+      // doubling and subtracting one are exact, q holds the remaining digits of p
+      while (undecided != 0 and q > 0) {
+        q *= 2;
+        const uint64_t w{word(r, e)};
+        if (q >= 1) {
+          q -= 1;
+          // digit of p is one, the comparison is decided where the random digit is zero
+          heads |= undecided & ~w;
+          undecided &= w;
+        } else
+          // digit of p is zero, the comparison is decided where the random digit is one
+          undecided &= ~w;
+      }
+      return heads;
+    }
+
+    template<typename R>
+    TRNG_CUDA_ENABLE uint64_t bits(R &r, std::integral_constant<int, 0>) {
+      uint64_t heads{0};
+      for (int i{0}; i < 64; ++i)
+        if (utility::uniformco<double>(r) < P.p())
+          heads |= uint64_t(1) << i;
+      return heads;
+    }
+
+    template<typename R>
+    TRNG_CUDA_ENABLE static uint64_t word(R &r, std::integral_constant<int, 64>) {
+      return static_cast<uint64_t>(r() - R::min());
+    }
+
+    template<typename R>
+    TRNG_CUDA_ENABLE static uint64_t word(R &r, std::integral_constant<int, 32>) {
+      const uint64_t upper{static_cast<uint64_t>(r() - R::min())};
+      return (upper << 32u) | static_cast<uint64_t>(r() - R::min());
+    }
   };
 
   // -------------------------------------------------------------------
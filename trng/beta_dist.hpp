@@ -40,6 +40,8 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/sampling_method.hpp>
+#include <trng/gamma_dist.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -49,7 +51,7 @@
 namespace trng {
 
   // uniform random number generator class
-  template<typename float_t = double>
+  template<typename float_t = double, typename method_t = sampling_method::inversion>
   class beta_dist {
   public:
     using result_type = float_t;
@@ -138,8 +140,7 @@ namespace trng {
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
-      return math::inv_Beta_I(utility::uniformoo<result_type>(r), P.alpha(), P.beta(),
-                              P.norm());
+      return sample(r, method_t{});
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
@@ -196,27 +197,45 @@ namespace trng {
         return 1;
       return math::inv_Beta_I(x, P.alpha(), P.beta(), P.norm());
     }
+
+  private:
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type sample(R &r, sampling_method::inversion) {
+      return math::inv_Beta_I(utility::uniformoo<result_type>(r), P.alpha(), P.beta(),
+                              P.norm());
+    }
+    // ratio X / (X + Y) of gamma distributed random numbers X and Y with shape parameters
+    // alpha and beta
+    template<typename R>
+    result_type sample(R &r, sampling_method::rejection) {
+      result_type x, y;
+      do {
+        x = detail::gamma_marsaglia_tsang(r, P.alpha());
+        y = detail::gamma_marsaglia_tsang(r, P.beta());
+      } while (x + y == 0);  // both may underflow for very small shape parameters
+      return x / (x + y);
+    }
   };
 
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator==(const beta_dist<float_t> &g1,
-                                          const beta_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator==(const beta_dist<float_t, method_t> &g1,
+                                          const beta_dist<float_t, method_t> &g2) {
     return g1.param() == g2.param();
   }
 
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator!=(const beta_dist<float_t> &g1,
-                                          const beta_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator!=(const beta_dist<float_t, method_t> &g1,
+                                          const beta_dist<float_t, method_t> &g2) {
     return g1.param() != g2.param();
   }
 
   // Streamable concept
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_ostream<char_t, traits_t> &operator<<(std::basic_ostream<char_t, traits_t> &out,
-                                                   const beta_dist<float_t> &g) {
+                                                   const beta_dist<float_t, method_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     out << "[beta " << g.param() << ']';
@@ -224,10 +243,10 @@ namespace trng {
     return out;
   }
 
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
-                                                   beta_dist<float_t> &g) {
-    typename beta_dist<float_t>::param_type P;
+                                                   beta_dist<float_t, method_t> &g) {
+    typename beta_dist<float_t, method_t>::param_type P;
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     in >> utility::ignore_spaces() >> utility::delim("[beta ") >> P >> utility::delim(']');
@@ -37,6 +37,8 @@
 #include <trng/limits.hpp>
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
+#include <trng/constants.hpp>
+#include <trng/sampling_method.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -54,10 +56,24 @@ namespace trng {
     private:
       double p_{0.5};
       int n_{0};
+      bool rejection_{false};
       std::vector<double> P_;
+      // guide table for fast lookup in P_
+      utility::discrete_guide_type guide_;
+      // constants of the table-free methods, which are applied to min(p, 1 - p) and whose
+      // result is mirrored if flip_ is true
+      bool flip_{false}, btrd_{false};
+      double r_{0}, q_n_{0}, bound_{0};
+      double m_{0}, nr_{0}, npq_{0}, a_{0}, b_{0}, c_{0}, alpha_{0}, v_r_{0}, u_rv_r_{0},
+          nm_{0}, h_{0};
 
       void calc_probabilities() {
         P_ = std::vector<double>();
+        guide_ = utility::discrete_guide_type();
+        if (rejection_) {
+          calc_constants();
+          return;
+        }
         P_.reserve(n_ + 1);
         double ln_binom{0.0};
         const double ln_p{math::ln(p_)};
@@ -75,6 +91,79 @@ namespace trng {
         // normailze, just in case of rounding errors
         for (std::vector<double>::size_type i{0}; i < P_.size(); ++i)
           P_[i] /= P_.back();
+
+        guide_ = utility::discrete_guide(P_.begin(), P_.end());
+      }
+
+      void calc_constants() {
+        flip_ = p_ > 0.5;
+        const double p{flip_ ? 1 - p_ : p_}, q{1 - p};
+        r_ = p / q;
+        btrd_ = n_ * p >= 10;
+        if (not btrd_) {
+          // inversion by sequential search
+          q_n_ = math::pow(q, n_);
+          bound_ = n_ * p + 10 * math::sqrt(n_ * p * q + 1);
+          if (bound_ > n_)
+            bound_ = n_;
+          return;
+        }
+        m_ = math::floor((n_ + 1) * p);
+        nr_ = (n_ + 1) * r_;
+        npq_ = n_ * p * q;
+        const double sqrt_npq{math::sqrt(npq_)};
+        b_ = 1.15 + 2.53 * sqrt_npq;
+        a_ = -0.0873 + 0.0248 * b_ + 0.01 * p;
+        c_ = n_ * p + 0.5;
+        alpha_ = (2.83 + 5.1 / b_) * sqrt_npq;
+        v_r_ = 0.92 - 4.2 / b_;
+        u_rv_r_ = 0.86 * v_r_;
+        nm_ = n_ - m_ + 1;
+        h_ = (m_ + 0.5) * math::ln((m_ + 1) / (r_ * nm_)) + stirlerr(m_ + 1) +
+             stirlerr(n_ - m_ + 1);
+      }
+
+      // error of Stirling's formula ln(k!) - (k + 1/2) ln(k) + k - ln(2 pi) / 2 for
+      // non-negative integers k
+      static double stirlerr(double k) {
+        static const double table[16]{0.0,
+                                      0.08106146679532726,
+                                      0.0413406959554093,
+                                      0.02767792568499834,
+                                      0.020790672103765093,
+                                      0.016644691189821193,
+                                      0.013876128823070748,
+                                      0.01189670994589177,
+                                      0.010411265261972096,
+                                      0.009255462182712733,
+                                      0.00833056343336287,
+                                      0.007573675487951841,
+                                      0.00694284010720953,
+                                      0.006408994188004207,
+                                      0.0059513701127588475,
+                                      0.005554733551962801};
+        if (k < 16)
+          return table[static_cast<int>(k)];
+        const double k2{k * k};
+        return (1.0 / 12 -
+                (1.0 / 360 - (1.0 / 1260 - (1.0 / 1680 - 1.0 / 1188 / k2) / k2) / k2) / k2) /
+               k;
+      }
+
+      // deviance term x ln(x / y) + y - x, evaluated without cancellation for x close to y
+      static double bd0(double x, double y) {
+        if (math::abs(x - y) < 0.1 * (x + y)) {
+          const double v{(x - y) / (x + y)}, v2{v * v};
+          double s{(x - y) * v}, e_j{2 * x * v};
+          for (int j{1};; ++j) {
+            e_j *= v2;
+            const double s_new{s + e_j / (2 * j + 1)};
+            if (s_new == s)
+              return s;
+            s = s_new;
+          }
+        }
+        return x * math::ln(x / y) + y - x;
       }
 
     public:
@@ -88,8 +177,16 @@ namespace trng {
         n_ = n_new;
         calc_probabilities();
       }
+      bool rejection() const { return rejection_; }
       param_type() = default;
       explicit param_type(double p, int n) : p_(p), n_(n) { calc_probabilities(); }
+      explicit param_type(double p, int n, sampling_method::inversion) : p_(p), n_(n) {
+        calc_probabilities();
+      }
+      explicit param_type(double p, int n, sampling_method::rejection)
+          : p_(p), n_(n), rejection_{true} {
+        calc_probabilities();
+      }
       friend class binomial_dist;
     };
 
@@ -99,19 +196,21 @@ namespace trng {
   public:
     // constructor
     explicit binomial_dist(double p, int n) : P{p, n} {}
+    explicit binomial_dist(double p, int n, sampling_method::inversion m) : P{p, n, m} {}
+    // the rejection method needs no table and has constant memory footprint and set-up cost
+    explicit binomial_dist(double p, int n, sampling_method::rejection m) : P{p, n, m} {}
     explicit binomial_dist(const param_type &P) : P{P} {}
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
-      return static_cast<int>(
-          utility::discrete(utility::uniformoo<double>(r), P.P_.begin(), P.P_.end()));
+      return sample(r, P);
     }
+    // samples directly from the given parameter, neither copies nor allocates memory
     template<typename R>
-    int operator()(R &r, const param_type &P) {
-      binomial_dist g(P);
-      return g(r);
+    int operator()(R &r, const param_type &p) {
+      return sample(r, p);
     }
     // property methods
     int min() const { return 0; }
@@ -126,6 +225,19 @@ namespace trng {
     double pdf(int x) const {
       if (x < 0 or x > P.n())
         return 0.0;
+      if (P.rejection_) {
+        // saddle point expansion, see C. Loader, "Fast and Accurate Computation of Binomial
+        // Probabilities", 2000
+        const double n{static_cast<double>(P.n())}, p{P.p()}, q{1 - p};
+        if (x == 0)
+          return math::exp(n * math::ln1p(-p));
+        if (x == P.n())
+          return math::exp(n * math::ln(p));
+        const double lc{param_type::stirlerr(n) - param_type::stirlerr(x) -
+                        param_type::stirlerr(n - x) - param_type::bd0(x, n * p) -
+                        param_type::bd0(n - x, n * q)};
+        return math::exp(lc) * math::sqrt(n / (2 * math::constants<double>::pi * x * (n - x)));
+      }
       if (x == 0)
         return P.P_[0];
       return P.P_[x] - P.P_[x - 1];
@@ -134,9 +246,108 @@ namespace trng {
     double cdf(int x) const {
       if (x < 0)
         return 0.0;
-      if (x <= P.n())
-        return P.P_[x];
-      return 1.0;
+      if (x >= P.n())
+        return 1.0;
+      if (P.rejection_) {
+        // sum up the probabilities of the shorter tail by recursion from pdf(x)
+        const double ratio{P.p() / (1 - P.p())};
+        if (x < P.n() * P.p()) {
+          double p_k{pdf(x)}, sum{0};
+          for (int k{x}; k >= 0 and p_k > sum * math::numeric_limits<double>::epsilon(); --k) {
+            sum += p_k;
+            p_k *= k / ((P.n() - k + 1) * ratio);
+          }
+          return sum;
+        }
+        double p_k{pdf(x + 1)}, sum{0};
+        for (int k{x + 1}; k <= P.n() and p_k > sum * math::numeric_limits<double>::epsilon();
+             ++k) {
+          sum += p_k;
+          p_k *= (P.n() - k) * ratio / (k + 1);
+        }
+        return 1.0 - sum;
+      }
+      return P.P_[x];
+    }
+
+  private:
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      if (P.rejection_) {
+        const int x{P.btrd_ ? btrd(r, P) : binv(r, P)};
+        return P.flip_ ? P.n() - x : x;
+      }
+      return static_cast<int>(
+          utility::discrete(utility::uniformoo<double>(r), P.P_.begin(), P.P_.end(), P.guide_));
+    }
+
+    // inversion by sequential search for n p < 10, expected time O(n p)
+    template<typename R>
+    static int binv(R &r, const param_type &P) {
+      while (true) {
+        double u{utility::uniformco<double>(r)}, p_x{P.q_n_};
+        int x{0};
+        while (u > p_x and x <= P.bound_) {
+          u -= p_x;
+          ++x;
+          p_x *= (P.n() - x + 1) * P.r_ / x;
+        }
+        if (x <= P.bound_)  // otherwise restart, rounding errors accumulated
+          return x;
+      }
+    }
+
+    // transformed rejection with decomposition, see W. Hoermann, "The generation of binomial
+    // random variates", Journal of Statistical Computation and Simulation 46 (1-2), 1993
+    template<typename R>
+    static int btrd(R &r, const param_type &P) {
+      while (true) {
+        double v{utility::uniformco<double>(r)}, u;
+        if (v <= P.u_rv_r_) {
+          u = v / P.v_r_ - 0.43;
+          return static_cast<int>(
+              math::floor((2 * P.a_ / (0.5 - math::abs(u)) + P.b_) * u + P.c_));
+        }
+        if (v >= P.v_r_) {
+          u = utility::uniformco<double>(r) - 0.5;
+        } else {
+          u = v / P.v_r_ - 0.93;
+          u = (u < 0 ? -0.5 : 0.5) - u;
+          v = utility::uniformco<double>(r) * P.v_r_;
+        }
+        const double us{0.5 - math::abs(u)};
+        const double k{math::floor((2 * P.a_ / us + P.b_) * u + P.c_)};
+        if (k < 0 or k > P.n())
+          continue;
+        v *= P.alpha_ / (P.a_ / (us * us) + P.b_);
+        const double km{math::abs(k - P.m_)};
+        if (km <= 15) {
+          // recursive evaluation of pdf(k) / pdf(m)
+          double f{1};
+          if (P.m_ < k)
+            for (double i{P.m_ + 1}; i <= k; ++i)
+              f *= P.nr_ / i - P.r_;
+          else
+            for (double i{k + 1}; i <= P.m_; ++i)
+              v *= P.nr_ / i - P.r_;
+          if (v <= f)
+            return static_cast<int>(k);
+          continue;
+        }
+        // squeeze acceptance and rejection
+        v = math::ln(v);
+        const double rho{km / P.npq_ * (((km / 3 + 0.625) * km + 1.0 / 6) / P.npq_ + 0.5)};
+        const double t{-km * km / (2 * P.npq_)};
+        if (v < t - rho)
+          return static_cast<int>(k);
+        if (v > t + rho)
+          continue;
+        const double nk{P.n() - k + 1};
+        if (v <= P.h_ + (P.n() + 1) * math::ln(P.nm_ / nk) +
+                      (k + 0.5) * math::ln(nk * P.r_ / (k + 1)) - param_type::stirlerr(k + 1) -
+                      param_type::stirlerr(P.n() - k + 1))
+          return static_cast<int>(k);
+      }
     }
   };
 
@@ -145,7 +356,7 @@ namespace trng {
   // EqualityComparable concept
   inline bool operator==(const binomial_dist::param_type &P1,
                          const binomial_dist::param_type &P2) {
-    return P1.p() == P2.p() and P1.n() == P2.n();
+    return P1.p() == P2.p() and P1.n() == P2.n() and P1.rejection() == P2.rejection();
   }
   inline bool operator!=(const binomial_dist::param_type &P1,
                          const binomial_dist::param_type &P2) {
@@ -159,7 +370,10 @@ namespace trng {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     out << '(' << std::setprecision(math::numeric_limits<double>::digits10 + 1) << P.p() << ' '
-        << P.n() << ')';
+        << P.n();
+    if (P.rejection())
+      out << " rejection";
+    out << ')';
     out.flags(flags);
     return out;
   }
@@ -169,11 +383,18 @@ namespace trng {
                                                    binomial_dist::param_type &P) {
     double p;
     int n;
+    bool rejection{false};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::delim('(') >> p >> utility::delim(' ') >> n >> utility::delim(')');
+    in >> utility::delim('(') >> p >> utility::delim(' ') >> n;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" rejection");
+      rejection = true;
+    }
+    in >> utility::delim(')');
     if (in)
-      P = binomial_dist::param_type(p, n);
+      P = rejection ? binomial_dist::param_type(p, n, sampling_method::rejection{})
+                    : binomial_dist::param_type(p, n);
     in.flags(flags);
     return in;
   }
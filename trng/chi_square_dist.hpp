@@ -39,6 +39,8 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/sampling_method.hpp>
+#include <trng/gamma_dist.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -48,7 +50,7 @@
 namespace trng {
 
   // uniform random number generator class
-  template<typename float_t = double>
+  template<typename float_t = double, typename method_t = sampling_method::inversion>
   class chi_square_dist {
   public:
     using result_type = float_t;
@@ -75,9 +77,8 @@ namespace trng {
         return P1.nu_ == P2.nu_;
       }
 
-      friend TRNG_CUDA_ENABLE inline bool operator!=(
-          const typename chi_square_dist<float_t>::param_type &P1,
-          const typename chi_square_dist<float_t>::param_type &P2) {
+      friend TRNG_CUDA_ENABLE inline bool operator!=(const param_type &P1,
+                                                     const param_type &P2) {
         return not(P1 == P2);
       }
 
@@ -127,7 +128,7 @@ namespace trng {
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
-      return icdf_(utility::uniformco<result_type>(r));
+      return sample(r, method_t{});
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
@@ -178,27 +179,37 @@ namespace trng {
         return math::numeric_limits<result_type>::infinity();
       return icdf_(x);
     }
+
+  private:
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type sample(R &r, sampling_method::inversion) {
+      return icdf_(utility::uniformco<result_type>(r));
+    }
+    template<typename R>
+    result_type sample(R &r, sampling_method::rejection) {
+      return detail::gamma_marsaglia_tsang(r, P.nu() / result_type(2)) * 2;
+    }
   };
 
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator==(const chi_square_dist<float_t> &g1,
-                                          const chi_square_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator==(const chi_square_dist<float_t, method_t> &g1,
+                                          const chi_square_dist<float_t, method_t> &g2) {
     return g1.param() == g2.param();
   }
 
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator!=(const chi_square_dist<float_t> &g1,
-                                          const chi_square_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator!=(const chi_square_dist<float_t, method_t> &g1,
+                                          const chi_square_dist<float_t, method_t> &g2) {
     return g1.param() != g2.param();
   }
 
   // Streamable concept
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_ostream<char_t, traits_t> &operator<<(std::basic_ostream<char_t, traits_t> &out,
-                                                   const chi_square_dist<float_t> &g) {
+                                                   const chi_square_dist<float_t, method_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     out << "[chi_square " << g.param() << ']';
@@ -206,10 +217,10 @@ namespace trng {
     return out;
   }
 
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
-                                                   chi_square_dist<float_t> &g) {
-    typename chi_square_dist<float_t>::param_type P;
+                                                   chi_square_dist<float_t, method_t> &g) {
+    typename chi_square_dist<float_t, method_t>::param_type P;
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     in >> utility::ignore_spaces() >> utility::delim("[chi_square ") >> P >>
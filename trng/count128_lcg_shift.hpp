@@ -222,6 +222,9 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt first, OutputIt last);
 
   private:
     parameter_type P;
@@ -258,6 +261,22 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, count128_lcg_shift>(*this) * x);
   }
 
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void count128_lcg_shift::generate(OutputIt first, OutputIt last) {
+    const result_type a{P.a}, b{P.b};
+    const uint128 increment{P.increment};
+    uint128 r{S.r};
+    for (; first != last; ++first) {
+      r += increment;
+      result_type t{(r.lo() ^ r.hi()) * a + b};
+      t ^= (t >> 23u);
+      t ^= (t << 41u);
+      t ^= (t >> 18u);
+      *first = t;
+    }
+    S.r = r;
+  }
+
   // Parallel random number generator concept
 
   TRNG_CUDA_ENABLE
@@ -36,13 +36,13 @@
 
 #include <trng/limits.hpp>
 #include <trng/utility.hpp>
-#include <trng/int_math.hpp>
+#include <trng/sampling_method.hpp>
 #include <ostream>
 #include <iomanip>
 #include <istream>
 #include <vector>
 #include <algorithm>
-#include <numeric>
+#include <cerrno>
 #include <ciso646>
 
 namespace trng {
@@ -55,17 +55,24 @@ namespace trng {
     class param_type {
     private:
       using size_type = std::vector<double>::size_type;
+      // P_ holds a tree in heap order, the children of node i are at arity_ * i + 1, ...,
+      // arity_ * i + arity_, the leaves, i.e., the weights, start at offset_
       std::vector<double> P_;
-      size_type N_{0}, layers_{0}, offset_{0};
+      size_type N_{0}, arity_{2}, layers_{0}, offset_{0};
 
-      explicit param_type(std::vector<double> P)
-          : P_(std::move(P)),
-            N_{P_.size()},
-            layers_{int_math::log2_ceil(N_)},
-            offset_{int_math::pow2(layers_) - 1} {
-        P_.resize(N_ + offset_);
-        std::copy_backward(P_.begin(), P_.begin() + N_, P_.end());
+      explicit param_type(std::vector<double> P, size_type arity)
+          : P_(std::move(P)), N_{P_.size()}, arity_{arity} {
+        size_type leaves{1};
+        while (leaves < N_) {
+          leaves *= arity_;
+          ++layers_;
+        }
+        offset_ = (leaves - 1) / (arity_ - 1);
+        // the last group of siblings is padded by zeros such that every group is complete
+        P_.resize(offset_ + (N_ + arity_ - 1) / arity_ * arity_);
+        std::copy_backward(P_.begin(), P_.begin() + N_, P_.begin() + offset_ + N_);
         std::fill(P_.begin(), P_.begin() + offset_, 0);
+        std::fill(P_.begin() + offset_ + N_, P_.end(), 0);
         update_all_layers();
       }
 
@@ -73,27 +80,63 @@ namespace trng {
       param_type() = default;
       template<typename iter>
       explicit param_type(iter first, iter last)
-          : param_type{std::vector<double>(first, last)} {}
-      explicit param_type(int n) : param_type{std::vector<double>(n, 1.0)} {}
+          : param_type{std::vector<double>(first, last), 2} {}
+      template<typename iter>
+      explicit param_type(iter first, iter last, sampling_method::inversion)
+          : param_type{std::vector<double>(first, last), 2} {}
+      template<typename iter>
+      explicit param_type(iter first, iter last, sampling_method::b_ary_tree)
+          : param_type{std::vector<double>(first, last), 8} {}
+      explicit param_type(int n) : param_type{std::vector<double>(n, 1.0), 2} {}
+      explicit param_type(int n, sampling_method::inversion)
+          : param_type{std::vector<double>(n, 1.0), 2} {}
+      explicit param_type(int n, sampling_method::b_ary_tree)
+          : param_type{std::vector<double>(n, 1.0), 8} {}
+      bool b_ary_tree() const { return arity_ != 2; }
 
     private:
-      void update_layer(size_type layer, size_type n) {
-        const size_type first{int_math::pow2(layer) - 1}, last{first + n};
-        for (size_type i{first}; i < last; ++i, ++i)
-          if (i + 1 < last)
-            P_[(i - 1) / 2] = P_[i] + P_[i + 1];
-          else
-            P_[(i - 1) / 2] = P_[i];
+      // sum of the weights of the children of node i, or zero if node i has no children
+      double children_sum(size_type i) const {
+        const size_type first{arity_ * i + 1};
+        if (first >= P_.size())
+          return 0;
+        double s{0};
+        for (size_type j{first}; j < first + arity_; ++j)
+          s += P_[j];
+        return s;
       }
       void update_all_layers() {
-        size_type layer = layers_;
-        if (layer > 0) {
-          update_layer(layer, N_);
-          --layer;
+        // children are stored behind their parents, thus a backward sweep updates every node
+        // after its children
+        for (size_type i{offset_}; i > 0; --i)
+          P_[i - 1] = children_sum(i - 1);
+      }
+      void update(size_type x) {
+        while (x > 0) {
+          x = (x - 1) / arity_;
+          P_[x] = children_sum(x);
+        }
+      }
+      // updates all ancestors of the nodes first, ..., last - 1 of one layer, each ancestor is
+      // recomputed once
+      void update(size_type first, size_type last) {
+        while (first > 0) {
+          first = (first - 1) / arity_;
+          last = (last - 2) / arity_ + 1;
+          for (size_type i{first}; i < last; ++i)
+            P_[i] = children_sum(i);
         }
-        while (layer > 0) {
-          update_layer(layer, int_math::pow2(layer));
-          --layer;
+      }
+      // updates all ancestors of the nodes of one layer in the sorted list dirty, each ancestor
+      // is recomputed once, dirty is modified
+      void update(std::vector<size_type> &dirty) {
+        while (not dirty.empty() and dirty.front() > 0) {
+          // the parent's index is a monotonic function of the child's index
+          for (size_type &i : dirty)
+            i = (i - 1) / arity_;
+          dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+          for (const size_type i : dirty)
+            P_[i] = children_sum(i);
         }
       }
 
@@ -110,36 +153,34 @@ namespace trng {
 
   private:
     param_type P;
+    // scratch space for update(), avoids memory allocations for repeated updates
+    std::vector<param_type::size_type> dirty_;
 
   public:
     // constructor
     template<typename iter>
     discrete_dist(iter first, iter last) : P(first, last) {}
+    template<typename iter>
+    discrete_dist(iter first, iter last, sampling_method::inversion m) : P(first, last, m) {}
+    // searching a tree with eight children per node is faster than binary search for large
+    // numbers of weights, because fewer cache lines are touched per sample
+    template<typename iter>
+    discrete_dist(iter first, iter last, sampling_method::b_ary_tree m) : P(first, last, m) {}
     explicit discrete_dist(int N) : P{N} {}
+    explicit discrete_dist(int N, sampling_method::inversion m) : P{N, m} {}
+    explicit discrete_dist(int N, sampling_method::b_ary_tree m) : P{N, m} {}
     explicit discrete_dist(const param_type &P) : P{P} {}
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
-      if (P.N_ == 0)
-        return -1;
-      double u(utility::uniformco<double>(r) * P.P_[0]);
-      param_type::size_type x{0};
-      while (x < P.offset_) {
-        if (u < P.P_[2 * x + 1]) {
-          x = 2 * x + 1;
-        } else {
-          u -= P.P_[2 * x + 1];
-          x = 2 * x + 2;
-        }
-      }
-      return static_cast<int>(x - P.offset_);
+      return sample(r, P);
     }
+    // samples directly from the given parameter, neither copies nor allocates memory
     template<typename R>
     int operator()(R &r, const param_type &p) {
-      discrete_dist g(p);
-      return g(r);
+      return sample(r, p);
     }
     // property methods
     int min() const { return 0; }
@@ -147,14 +188,35 @@ namespace trng {
     const param_type &param() const { return P; }
     void param(const param_type &P_new) { P = P_new; }
     void param(int x, double p) {
-      x += static_cast<int>(P.offset_);
-      P.P_[x] = p;
-      if (x > 0) {
-        do {
-          x = (x - 1) / 2;
-          P.P_[x] = P.P_[2 * x + 1] + P.P_[2 * x + 2];
-        } while (x > 0);
+      const param_type::size_type i{x + P.offset_};
+      P.P_[i] = p;
+      P.update(i);
+    }
+    // sets the weights of x, x + 1, ... to the values in [first, last), nodes of the tree
+    // that depend on several of the modified weights are recomputed only once
+    template<typename iter>
+    void update(int x, iter first, iter last) {
+      if (first == last)
+        return;
+      const param_type::size_type i{x + P.offset_};
+      param_type::size_type j{i};
+      for (; first != last; ++first, ++j)
+        P.P_[j] = *first;
+      P.update(i, j);
+    }
+    // sets the weights given by a range of (index, weight) pairs, e.g., of type
+    // std::pair<int, double>, nodes of the tree that depend on several of the modified
+    // weights are recomputed only once
+    template<typename iter>
+    void update(iter first, iter last) {
+      dirty_.clear();
+      for (; first != last; ++first) {
+        const param_type::size_type i{first->first + P.offset_};
+        P.P_[i] = first->second;
+        dirty_.push_back(i);
       }
+      std::sort(dirty_.begin(), dirty_.end());
+      P.update(dirty_);
     }
     // probability density function
     double pdf(int x) const {
@@ -164,12 +226,82 @@ namespace trng {
     double cdf(int x) const {
       if (x < 0)
         return 0.0;
-      if (x < static_cast<int>(P.N_))
-        return std::accumulate(P.P_.begin() + P.offset_, P.P_.begin() + x + P.offset_ + 1,
-                               0.0) /
-               P.P_[0];
+      if (x < static_cast<int>(P.N_)) {
+        // sum of the weight of x and the weights of all left siblings of x and its ancestors
+        param_type::size_type i{x + P.offset_};
+        double s{P.P_[i]};
+        while (i > 0) {
+          for (param_type::size_type j{(i - 1) / P.arity_ * P.arity_ + 1}; j < i; ++j)
+            s += P.P_[j];
+          i = (i - 1) / P.arity_;
+        }
+        return s / P.P_[0];
+      }
       return 1.0;
     }
+    // inverse cumulative density function, smallest x with cdf(x) >= p, descends the tree in
+    // O(log N) steps
+    int icdf(double p) const {
+      if (P.N_ == 0 or not(p >= 0 and p <= 1)) {
+        errno = EDOM;
+        return -1;
+      }
+      double u{p * P.P_[0]};
+      param_type::size_type x{0};
+      while (x < P.offset_) {
+        const param_type::size_type first{P.arity_ * x + 1};
+        param_type::size_type k{0};
+        while (k + 1 < P.arity_ and u > P.P_[first + k]) {
+          u -= P.P_[first + k];
+          ++k;
+        }
+        x = first + k;
+      }
+      // u may exceed the sum of all weights by rounding errors
+      return static_cast<int>(std::min(x - P.offset_, P.N_ - 1));
+    }
+
+  private:
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      if (P.N_ == 0)
+        return -1;
+      const double u(utility::uniformco<double>(r) * P.P_[0]);
+      return static_cast<int>(P.arity_ == 2 ? search<2>(u, P) : search<8>(u, P));
+    }
+
+    // descends from the root to the leaf that u falls into, the number of children of each
+    // node is a compile-time constant, such that the loops over the children are unrolled and
+    // the comparisons are vectorized by the compiler
+    template<param_type::size_type arity>
+    static param_type::size_type search(double u, const param_type &P) {
+      using size_type = param_type::size_type;
+      size_type x{0};
+      while (x < P.offset_) {
+        const double *const c{P.P_.data() + arity * x + 1};
+        // in a wide tree, the children of all children are loaded while the current node is
+        // searched, which hides the latency of one memory access per layer
+        if (arity > 2) {
+          const size_type first{arity * (arity * x + 1) + 1};
+          for (size_type j{0}; j < arity and first + arity * j < P.P_.size(); ++j)
+            utility::prefetch(P.P_.data() + first + arity * j);
+        }
+        double s[arity];
+        s[0] = c[0];
+        for (size_type j{1}; j < arity; ++j)
+          s[j] = s[j - 1] + c[j];
+        size_type k{0};
+        for (size_type j{0}; j + 1 < arity; ++j)
+          k += s[j] <= u;
+        // u may exceed the sum of all weights by rounding errors, never pick a zero weight
+        while (k > 0 and c[k] == 0)
+          --k;
+        if (k > 0)
+          u -= s[k - 1];
+        x = arity * x + 1 + k;
+      }
+      return x - P.offset_;
+    }
   };
 
   // -------------------------------------------------------------------
@@ -177,7 +309,7 @@ namespace trng {
   // EqualityComparable concept
   inline bool operator==(const discrete_dist::param_type &P1,
                          const discrete_dist::param_type &P2) {
-    return P1.P_ == P2.P_;
+    return P1.arity_ == P2.arity_ and P1.P_ == P2.P_;
   }
   inline bool operator!=(const discrete_dist::param_type &P1,
                          const discrete_dist::param_type &P2) {
@@ -191,11 +323,13 @@ namespace trng {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     out << '(' << P.N_ << ' ';
-    for (std::vector<double>::size_type i{P.offset_}; i < P.P_.size(); ++i) {
+    for (std::vector<double>::size_type i{P.offset_}; i < P.offset_ + P.N_; ++i) {
       out << std::setprecision(math::numeric_limits<double>::digits10 + 1) << P.P_[i];
-      if (i + 1 < P.P_.size())
+      if (i + 1 < P.offset_ + P.N_)
         out << ' ';
     }
+    if (P.b_ary_tree())
+      out << " b_ary_tree";
     out << ')';
     out.flags(flags);
     return out;
@@ -207,6 +341,7 @@ namespace trng {
     double p;
     std::vector<double>::size_type n;
     std::vector<double> P_new;
+    bool b_ary_tree{false};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     in >> utility::delim('(') >> n >> utility::delim(' ');
@@ -216,9 +351,15 @@ namespace trng {
         in >> utility::delim(' ');
       P_new.push_back(p);
     }
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" b_ary_tree");
+      b_ary_tree = true;
+    }
     in >> utility::delim(')');
     if (in)
-      P = discrete_dist::param_type(P_new.begin(), P_new.end());
+      P = b_ary_tree ? discrete_dist::param_type(P_new.begin(), P_new.end(),
+                                                 sampling_method::b_ary_tree{})
+                     : discrete_dist::param_type(P_new.begin(), P_new.end());
     in.flags(flags);
     return in;
   }
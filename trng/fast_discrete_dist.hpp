@@ -44,12 +44,19 @@
 
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
+#include <trng/int_types.hpp>
+#include <trng/int_math.hpp>
 #include <ostream>
 #include <iomanip>
 #include <istream>
 #include <vector>
 #include <numeric>
 #include <functional>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <type_traits>
+#include <utility>
 #include <ciso646>
 
 namespace trng {
@@ -62,37 +69,139 @@ namespace trng {
     class param_type {
     private:
       using size_type = std::vector<double>::size_type;
-      std::vector<double> P, F;
-      std::vector<int> L;
+      // threshold and alias of a bucket are stored side by side, such that a random number is
+      // generated by reading a single cache line
+      struct bucket {
+        double F;
+        int L;
+      };
+      // state of a chunk of buckets during the construction of the alias table
+      struct chunk {
+        double sum;
+        size_type i, j;
+      };
+      std::vector<double> P;
+      std::vector<bucket> B;
       size_type N{0};
 
-      explicit param_type(std::vector<double> P)
-          : P(std::move(P)), F(P.size()), L(P.size()), N(P.size()) {
-        const double s{std::accumulate(P.begin(), P.end(), 0.0)};
-        if (s > 0.0) {
-          for (auto &val : P)
-            val /= s;
-          std::vector<int> G, S;
-          G.reserve(N);
-          S.reserve(N);
-          for (int i{0}; i < F.size(); ++i) {
-            F[i] = N * P[i];
-            if (F[i] < 1.0)
-              S.push_back(i);
-            else
+      // the alias table is built in chunks of fixed size, which are processed in parallel if
+      // OpenMP is enabled, the result does not depend on the number of threads
+      static constexpr size_type chunk_size() { return 65536; }
+
+      explicit param_type(std::vector<double> P_new)
+          : P(std::move(P_new)), B(P.size()), N(P.size()) {
+        build();
+      }
+
+      template<typename iter>
+      void assign(iter first, iter last) {
+        P.assign(first, last);
+        N = P.size();
+        B.resize(N);
+        build();
+      }
+
+      // buckets are classified by their original weights, thresholds of heavy buckets change
+      // during the construction
+      bool light(size_type i) const { return static_cast<double>(N) * P[i] < 1.0; }
+      size_type next_light(size_type i, size_type last) const {
+        while (i < last and not light(i))
+          ++i;
+        return i;
+      }
+      size_type next_heavy(size_type i, size_type last) const {
+        while (i < last and light(i))
+          ++i;
+        return i;
+      }
+
+      // pairs the light and heavy buckets of [first, last) in a single sweep without work
+      // lists, see L. Huebschle-Schneider and P. Sanders, "Parallel Weighted Random Sampling",
+      // ACM Transactions on Mathematical Software 48 (3), 2022, on return, c.i is the first
+      // light bucket that has not been filled and c.j is the heavy bucket in use, buckets
+      // behind c.i and c.j are untouched
+      void sweep(chunk &c, size_type first, size_type last) {
+        c.i = next_light(first, last);
+        c.j = next_heavy(first, last);
+        if (c.j == last)
+          return;
+        while (true) {
+          if (B[c.j].F >= 1.0) {
+            if (c.i == last)
+              return;
+            B[c.i].L = static_cast<int>(c.j);
+            B[c.j].F -= 1.0 - B[c.i].F;
+            c.i = next_light(c.i + 1, last);
+          } else {
+            // heavy bucket became light, fill it from the next heavy bucket
+            const size_type k{next_heavy(c.j + 1, last)};
+            if (k == last)
+              return;
+            B[c.j].L = static_cast<int>(k);
+            B[k].F -= 1.0 - B[c.j].F;
+            c.j = k;
+          }
+        }
+      }
+
+      void build() {
+        const size_type chunks{(N + chunk_size() - 1) / chunk_size()};
+        const long chunks_l{static_cast<long>(chunks)};
+        std::vector<chunk> C(chunks);
+#if defined _OPENMP
+#pragma omp parallel for
+#endif
+        for (long k = 0; k < chunks_l; ++k) {
+          const size_type first{k * chunk_size()}, last{std::min(first + chunk_size(), N)};
+          C[k].sum = std::accumulate(P.begin() + first, P.begin() + last, 0.0);
+        }
+        double s{0};
+        for (const chunk &c : C)
+          s += c.sum;
+        if (not(s > 0.0)) {
+          std::fill(B.begin(), B.end(), bucket{0.0, 0});
+          return;
+        }
+#if defined _OPENMP
+#pragma omp parallel for
+#endif
+        for (long k = 0; k < chunks_l; ++k) {
+          const size_type first{k * chunk_size()}, last{std::min(first + chunk_size(), N)};
+          for (size_type i{first}; i < last; ++i) {
+            P[i] /= s;
+            B[i].F = static_cast<double>(N) * P[i];
+            B[i].L = static_cast<int>(i);
+          }
+          sweep(C[k], first, last);
+        }
+        // second pass over the buckets that remained in the chunks
+        std::vector<size_type> G, S;
+        for (size_type k{0}; k < chunks; ++k) {
+          const size_type last{std::min((k + 1) * chunk_size(), N)};
+          if (C[k].j < last) {
+            (B[C[k].j].F < 1.0 ? S : G).push_back(C[k].j);
+            for (size_type i{next_heavy(C[k].j + 1, last)}; i < last;
+                 i = next_heavy(i + 1, last))
               G.push_back(i);
           }
-          while ((not S.empty()) and (not G.empty())) {
-            const int k{G.back()}, j{S.back()};
-            L[j] = k;
-            F[k] -= 1.0 - F[j];
-            S.pop_back();
-            if (F[k] < 1.0) {
-              G.pop_back();
-              S.push_back(k);
-            }
+          for (size_type i{C[k].i}; i < last; i = next_light(i + 1, last))
+            S.push_back(i);
+        }
+        while ((not S.empty()) and (not G.empty())) {
+          const size_type k{G.back()}, j{S.back()};
+          B[j].L = static_cast<int>(k);
+          B[k].F -= 1.0 - B[j].F;
+          S.pop_back();
+          if (B[k].F < 1.0) {
+            G.pop_back();
+            S.push_back(k);
           }
         }
+        // remaining buckets are full up to rounding errors
+        for (const size_type i : G)
+          B[i].F = 1.0;
+        for (const size_type i : S)
+          B[i].F = 1.0;
       }
 
     public:
@@ -114,6 +223,26 @@ namespace trng {
 
   private:
     param_type P;
+    // cumulative probabilities, computed by the first call of cdf() or icdf() and discarded
+    // whenever the parameters change, the table is published atomically such that concurrent
+    // calls of const methods are safe
+    mutable std::atomic<std::vector<double> *> C{nullptr};
+
+    const std::vector<double> &cumulative() const {
+      std::vector<double> *C_old{C.load(std::memory_order_acquire)};
+      if (C_old != nullptr)
+        return *C_old;
+      std::vector<double> *C_new{new std::vector<double>(P.N)};
+      std::partial_sum(P.P.begin(), P.P.end(), C_new->begin());
+      // another thread may have published its table meanwhile
+      if (C.compare_exchange_strong(C_old, C_new, std::memory_order_acq_rel,
+                                    std::memory_order_acquire))
+        return *C_new;
+      delete C_new;
+      return *C_old;
+    }
+
+    void clear_cumulative() { delete C.exchange(nullptr, std::memory_order_acq_rel); }
 
   public:
     // constructor
@@ -121,36 +250,98 @@ namespace trng {
     explicit fast_discrete_dist(iter first, iter last) : P{first, last} {}
     explicit fast_discrete_dist(int N) : P{N} {}
     explicit fast_discrete_dist(const param_type &P) : P{P} {}
+    fast_discrete_dist(const fast_discrete_dist &other) : P{other.P} {}
+    fast_discrete_dist(fast_discrete_dist &&other) noexcept
+        : P{std::move(other.P)}, C{other.C.exchange(nullptr, std::memory_order_acq_rel)} {}
+    fast_discrete_dist &operator=(const fast_discrete_dist &other) {
+      if (this != &other)
+        param(other.P);
+      return *this;
+    }
+    fast_discrete_dist &operator=(fast_discrete_dist &&other) noexcept {
+      if (this != &other) {
+        P = std::move(other.P);
+        delete C.exchange(other.C.exchange(nullptr, std::memory_order_acq_rel),
+                          std::memory_order_acq_rel);
+      }
+      return *this;
+    }
+    ~fast_discrete_dist() { clear_cumulative(); }
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
-      const double U{utility::uniformco<double>(r) * P.N};
-      const int I{static_cast<int>(U)};
-      return U - I <= P.F[I] ? I : P.L[I];
+      return sample(r, P);
     }
+    // samples directly from the given parameter, neither copies nor allocates memory
     template<typename R>
-    int operator()(R &r, const param_type &P) {
-      fast_discrete_dist g(P);
-      return g(r);
+    int operator()(R &r, const param_type &p) {
+      return sample(r, p);
     }
     // property methods
     int min() const { return 0; }
-    int max() const { return P.N - 1; }
+    int max() const { return static_cast<int>(P.N - 1); }
     const param_type &param() const { return P; }
-    void param(const param_type &P_new) { P = P_new; }
+    void param(const param_type &P_new) {
+      P = P_new;
+      clear_cumulative();
+    }
+    // sets new weights, the memory of the current alias table is reused
+    template<typename iter>
+    void param(iter first, iter last) {
+      P.assign(first, last);
+      clear_cumulative();
+    }
     // probability density function
-    double pdf(int x) const { return (x < 0 or x >= P.N) ? 0.0 : P.P[x]; }
+    double pdf(int x) const { return (x < 0 or x >= static_cast<int>(P.N)) ? 0.0 : P.P[x]; }
     // cumulative density function
     double cdf(int x) const {
       if (x < 0)
         return 0.0;
-      if (x < P.N)
-        return std::accumulate(P.P.begin(), P.P.begin() + x + 1, 0.0);
+      if (x < static_cast<int>(P.N))
+        return cumulative()[x];
       return 1.0;
     }
-  };  // namespace trng
+    // inverse cumulative density function, smallest x with cdf(x) >= p
+    int icdf(double p) const {
+      if (P.N == 0 or not(p >= 0 and p <= 1)) {
+        errno = EDOM;
+        return -1;
+      }
+      const std::vector<double> &C{cumulative()};
+      // p may exceed the sum of all probabilities by rounding errors
+      const auto i{std::lower_bound(C.begin(), C.end() - 1, p)};
+      return static_cast<int>(i - C.begin());
+    }
+
+  private:
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      return sample(r, P, std::integral_constant<bool, utility::engine_bits<R>::value == 64>{});
+    }
+
+    // engines with 64-bit output, the upper half of the product of a random number and N
+    // gives the bucket and the lower half gives the uniform value that is compared with the
+    // bucket's threshold, no conversion to floating point is needed for the bucket
+    template<typename R>
+    static int sample(R &r, const param_type &P, std::true_type) {
+      uint64_t frac;
+      const uint64_t I{int_math::mul_hi_lo(r() - R::min(), P.N, frac)};
+      const param_type::bucket &b{P.B[I]};
+      return static_cast<double>(frac >> 11u) * (1.0 / 9007199254740992.0) <= b.F
+                 ? static_cast<int>(I)
+                 : b.L;
+    }
+
+    template<typename R>
+    static int sample(R &r, const param_type &P, std::false_type) {
+      const double U{utility::uniformco<double>(r) * P.N};
+      const int I{static_cast<int>(U)};
+      const param_type::bucket &b{P.B[I]};
+      return U - I <= b.F ? I : b.L;
+    }
+  };
 
   // -------------------------------------------------------------------
 
@@ -39,6 +39,8 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/sampling_method.hpp>
+#include <trng/normal_dist.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -47,8 +49,41 @@
 
 namespace trng {
 
+  namespace detail {
+
+    // standard gamma distributed random number with shape parameter kappa > 0, see G.
+    // Marsaglia and W. W. Tsang, "A Simple Method for Generating Gamma Variables", ACM
+    // Transactions on Mathematical Software 26 (3), 2000, for kappa < 1 the random number with
+    // shape kappa + 1 is multiplied by U^(1/kappa)
+    template<typename float_t, typename R>
+    float_t gamma_marsaglia_tsang(R &r, float_t kappa) {
+      const bool boost{kappa < 1};
+      const float_t d{(boost ? kappa + 1 : kappa) - float_t(1) / float_t(3)};
+      const float_t c{1 / math::sqrt(9 * d)};
+      normal_dist<float_t, sampling_method::rejection> N(0, 1);
+      while (true) {
+        float_t x, v;
+        do {
+          x = N(r);
+          v = 1 + c * x;
+        } while (v <= 0);
+        v = v * v * v;
+        const float_t u{utility::uniformoo<float_t>(r)};
+        const float_t x2{x * x};
+        // squeeze, avoids the logarithms in most cases
+        if (u < 1 - float_t(0.0331) * x2 * x2 or
+            math::ln(u) < x2 / 2 + d * (1 - v + math::ln(v))) {
+          if (boost)
+            return d * v * math::exp(math::ln(utility::uniformoo<float_t>(r)) / kappa);
+          return d * v;
+        }
+      }
+    }
+
+  }  // namespace detail
+
   // uniform random number generator class
-  template<typename float_t = double>
+  template<typename float_t = double, typename method_t = sampling_method::inversion>
   class gamma_dist {
   public:
     using result_type = float_t;
@@ -133,7 +168,7 @@ namespace trng {
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
-      return icdf_(utility::uniformco<result_type>(r));
+      return sample(r, method_t{});
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &p) {
@@ -188,27 +223,37 @@ namespace trng {
         return math::numeric_limits<result_type>::infinity();
       return icdf_(x);
     }
+
+  private:
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type sample(R &r, sampling_method::inversion) {
+      return icdf_(utility::uniformco<result_type>(r));
+    }
+    template<typename R>
+    result_type sample(R &r, sampling_method::rejection) {
+      return detail::gamma_marsaglia_tsang(r, P.kappa()) * P.theta();
+    }
   };
 
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator==(const gamma_dist<float_t> &g1,
-                                          const gamma_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator==(const gamma_dist<float_t, method_t> &g1,
+                                          const gamma_dist<float_t, method_t> &g2) {
     return g1.param() == g2.param();
   }
 
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator!=(const gamma_dist<float_t> &g1,
-                                          const gamma_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator!=(const gamma_dist<float_t, method_t> &g1,
+                                          const gamma_dist<float_t, method_t> &g2) {
     return g1.param() != g2.param();
   }
 
   // Streamable concept
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_ostream<char_t, traits_t> &operator<<(std::basic_ostream<char_t, traits_t> &out,
-                                                   const gamma_dist<float_t> &g) {
+                                                   const gamma_dist<float_t, method_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     out << "[gamma " << g.param() << ']';
@@ -216,10 +261,10 @@ namespace trng {
     return out;
   }
 
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
-                                                   gamma_dist<float_t> &g) {
-    typename gamma_dist<float_t>::param_type P;
+                                                   gamma_dist<float_t, method_t> &g) {
+    typename gamma_dist<float_t, method_t>::param_type P;
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     in >> utility::ignore_spaces() >> utility::delim("[gamma ") >> P >> utility::delim(']');
@@ -59,11 +59,14 @@ namespace trng {
           d_{0},               // number of selected balls
           x_min{0}, x_max{0};  // minimum and maximum values of random variable
       std::vector<double> P_;
+      // guide table for fast lookup in P_
+      utility::discrete_guide_type guide_;
 
       void calc_probabilities() {
         x_min = std::max(0, d_ - n_ + m_);
         x_max = std::min(d_, m_);
         P_ = std::vector<double>();
+        guide_ = utility::discrete_guide_type();
         for (int x{x_min}; x <= x_max; ++x)
           P_.push_back(math::exp(
               math::ln_binomial(static_cast<double>(m_), static_cast<double>(x)) +
@@ -73,6 +76,8 @@ namespace trng {
           P_[i] += P_[i - 1];
         for (std::vector<double>::size_type i{0}; i < P_.size(); ++i)
           P_[i] /= P_.back();
+
+        guide_ = utility::discrete_guide(P_.begin(), P_.end());
       }
 
     public:
@@ -108,13 +113,12 @@ namespace trng {
     // random numbers
     template<typename R>
     int operator()(R &r) {
-      return P.x_min + static_cast<int>(utility::discrete(utility::uniformoo<double>(r),
-                                                          P.P_.begin(), P.P_.end()));
+      return sample(r, P);
     }
+    // samples directly from the given parameter, neither copies nor allocates memory
     template<typename R>
-    int operator()(R &r, const param_type &P) {
-      hypergeometric_dist g(P);
-      return g(r);
+    int operator()(R &r, const param_type &p) {
+      return sample(r, p);
     }
     // property methods
     int min() const { return P.x_min; }
@@ -144,6 +148,13 @@ namespace trng {
         return 1.0;
       return P.P_[x - P.x_min];
     }
+
+  private:
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      return P.x_min + static_cast<int>(utility::discrete(utility::uniformoo<double>(r),
+                                                          P.P_.begin(), P.P_.end(), P.guide_));
+    }
   };
 
   // -------------------------------------------------------------------
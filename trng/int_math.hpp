@@ -78,6 +78,37 @@ namespace trng {
                  : ceil2(x + T(1)) - T(1);
     }
 
+    // number of bits set in x
+    TRNG_CUDA_ENABLE
+    inline int popcount(uint64_t x) {
+#if (defined __GNUC__ || defined __clang__) && !(defined TRNG_CUDA)
+      return __builtin_popcountll(x);
+#else
+      x = x - ((x >> 1u) & 0x5555555555555555ull);
+      x = (x & 0x3333333333333333ull) + ((x >> 2u) & 0x3333333333333333ull);
+      x = (x + (x >> 4u)) & 0x0f0f0f0f0f0f0f0full;
+      return static_cast<int>((x * 0x0101010101010101ull) >> 56u);
+#endif
+    }
+
+    // upper 64 bits of the full product of a and b, the lower 64 bits are stored in lo
+    TRNG_CUDA_ENABLE
+    inline uint64_t mul_hi_lo(uint64_t a, uint64_t b, uint64_t &lo) {
+#if (defined __GNUC__ || defined __clang__) && (defined __SIZEOF_INT128__) && \
+    !(defined TRNG_CUDA)
+      __extension__ using uint128_t = unsigned __int128;
+      const uint128_t p{static_cast<uint128_t>(a) * b};
+      lo = static_cast<uint64_t>(p);
+      return static_cast<uint64_t>(p >> 64u);
+#else
+      const uint64_t a0{a & 0xffffffffu}, a1{a >> 32u}, b0{b & 0xffffffffu}, b1{b >> 32u};
+      const uint64_t p00{a0 * b0}, p01{a0 * b1}, p10{a1 * b0}, p11{a1 * b1};
+      const uint64_t mid{(p00 >> 32u) + (p01 & 0xffffffffu) + (p10 & 0xffffffffu)};
+      lo = (mid << 32u) | (p00 & 0xffffffffu);
+      return p11 + (p01 >> 32u) + (p10 >> 32u) + (mid >> 32u);
+#endif
+    }
+
     // ---------------------------------------------------------------
 
     template<int n>
@@ -321,20 +352,60 @@ namespace trng {
 
     //------------------------------------------------------------------
 
+    // b^n mod m via two tables holding b^i for 0 <= i < 2^16 and b^(2^16 i) for 0 <= i < 2^15,
+    // the tables are not owned, which allows to refer to tables that are computed at build
+    // time
     template<int32_t m, int32_t b>
-    class power {
-      uint32_t b_power0[0x10000], b_power1[0x08000];
+    class static_power {
+      const uint32_t *b_power0, *b_power1;
 
-      int32_t pow(int32_t n) {
-        int64_t p{1}, t{b};
-        while (n > 0) {
-          if ((n & 0x1) == 0x1)
-            p = modulo<m, 1>(p * t);
-          t = modulo<m, 1>(t * t);
-          n /= 2;
-        }
-        return static_cast<int32_t>(p);
+    public:
+      constexpr static_power(const uint32_t *b_power0, const uint32_t *b_power1)
+          : b_power0{b_power0}, b_power1{b_power1} {}
+      static int32_t lookup(const uint32_t *b_power0, const uint32_t *b_power1, int32_t n) {
+        return modulo<m, 1>(static_cast<uint64_t>(b_power1[n >> 16]) *
+                            static_cast<uint64_t>(b_power0[n & 0xffff]));
+      }
+      int32_t operator()(int32_t n) const { return lookup(b_power0, b_power1, n); }
+    };
+
+    // same as static_power but with three tables of 2^11, 2^10, and 2^10 entries (16 KiB),
+    // which fit into the L1 cache, at the cost of one additional modular multiplication
+    template<int32_t m, int32_t b>
+    class static_compact_power {
+      const uint32_t *b_power0, *b_power1, *b_power2;
+
+    public:
+      constexpr static_compact_power(const uint32_t *b_power0, const uint32_t *b_power1,
+                                     const uint32_t *b_power2)
+          : b_power0{b_power0}, b_power1{b_power1}, b_power2{b_power2} {}
+      static int32_t lookup(const uint32_t *b_power0, const uint32_t *b_power1,
+                            const uint32_t *b_power2, int32_t n) {
+        const uint64_t p{static_cast<uint32_t>(
+            modulo<m, 1>(static_cast<uint64_t>(b_power2[n >> 21]) *
+                         static_cast<uint64_t>(b_power1[(n >> 11) & 0x3ff])))};
+        return modulo<m, 1>(p * static_cast<uint64_t>(b_power0[n & 0x7ff]));
+      }
+      int32_t operator()(int32_t n) const { return lookup(b_power0, b_power1, b_power2, n); }
+    };
+
+    // compute b^n mod m
+    template<int32_t m, int32_t b>
+    int32_t pow_mod(int32_t n) {
+      int64_t p{1}, t{b};
+      while (n > 0) {
+        if ((n & 0x1) == 0x1)
+          p = modulo<m, 1>(p * t);
+        t = modulo<m, 1>(t * t);
+        n /= 2;
       }
+      return static_cast<int32_t>(p);
+    }
+
+    // same as static_power but with tables that are computed at construction
+    template<int32_t m, int32_t b>
+    class power {
+      uint32_t b_power0[0x10000], b_power1[0x08000];
 
     public:
       // make it non-copyable
@@ -343,16 +414,49 @@ namespace trng {
 
       power() {
         for (int32_t i{0}; i < 0x10000; ++i)
-          b_power0[i] = pow(i);
+          b_power0[i] = pow_mod<m, b>(i);
         for (int32_t i{0}; i < 0x08000; ++i)
-          b_power1[i] = pow(i * 0x10000);
+          b_power1[i] = pow_mod<m, b>(i * 0x10000);
       }
       int32_t operator()(int32_t n) const {
-        return modulo<m, 1>(static_cast<uint64_t>(b_power1[n >> 16]) *
-                            static_cast<uint64_t>(b_power0[n & 0xffff]));
+        return static_power<m, b>::lookup(b_power0, b_power1, n);
+      }
+    };
+
+    // same as static_compact_power but with tables that are computed at construction
+    template<int32_t m, int32_t b>
+    class compact_power {
+      uint32_t b_power0[0x800], b_power1[0x400], b_power2[0x400];
+
+    public:
+      // make it non-copyable
+      compact_power &operator=(const compact_power &) = delete;
+      compact_power(const compact_power &) = delete;
+
+      compact_power() {
+        for (int32_t i{0}; i < 0x800; ++i)
+          b_power0[i] = pow_mod<m, b>(i);
+        for (int32_t i{0}; i < 0x400; ++i)
+          b_power1[i] = pow_mod<m, b>(i * 0x800);
+        for (int32_t i{0}; i < 0x400; ++i)
+          b_power2[i] = pow_mod<m, b>(i * 0x200000);
+      }
+      int32_t operator()(int32_t n) const {
+        return static_compact_power<m, b>::lookup(b_power0, b_power1, b_power2, n);
       }
     };
 
+    // table of powers for the output transformation of the yarn generators, its contents are
+    // computed at build time, see power_tables.hpp, the compact version is selected by the
+    // TRNG_COMPACT_POWER_TABLE option
+#if defined TRNG_COMPACT_POWER_TABLE
+    template<int32_t m, int32_t b>
+    using power_table = static_compact_power<m, b>;
+#else
+    template<int32_t m, int32_t b>
+    using power_table = static_power<m, b>;
+#endif
+
   }  // namespace int_math
 
 }  // namespace trng
@@ -44,6 +44,7 @@
 #include <ostream>
 #include <istream>
 #include <sstream>
+#include <memory>
 #include <ciso646>
 
 namespace trng {
@@ -149,36 +150,28 @@ namespace trng {
       S.index = B - 1;
     }
 
-    void discard(unsigned long long n) {
-      const unsigned int matrix_size = B;
-      using matrix_type = matrix<GF2, matrix_size>;
-      using vector_type = vector<result_type, matrix_size>;
-      using size_type = typename matrix_type::size_type;
-      const unsigned long long n_pivot{int_math::log2_ceil(n) * B * B * B};
-      constexpr auto mask = int_math::mask(B);
-      if (n > n_pivot) {
-        const unsigned long long n_partial{n - matrix_size};
-        matrix_type M;
-        for (size_type i{0}; i < matrix_size - 1; ++i)
-          M(i, i + 1) = GF2(true);
-        M(matrix_size - 1, matrix_size - B) = GF2(true);
-        M(matrix_size - 1, matrix_size - A) = GF2(true);
-        M = power(M, n_partial);
-        vector_type V;
-        for (size_type i{0}; i < matrix_size; ++i)
-          V(matrix_size - 1 - i) = S.r[(S.index - i) & mask];
-        vector_type W;
-        for (size_type i{0}; i < matrix_size; ++i) {
-          result_type sum{};
-          for (size_type k{0}; k < matrix_size; ++k)
-            sum ^= M(i, k) * V(k);
-          W(i) = sum;
-        }
-        S.index = static_cast<unsigned int>(S.index + n_partial);
-        S.index &= mask;
-        for (size_type i{0}; i < matrix_size; ++i)
-          S.r[(S.index - i) & mask] = W(matrix_size - 1 - i);
-        n -= n_partial;
+    void discard(unsigned long long n) { jump(n); }
+
+    // Parallel random number generator concept
+    // leapfrog splitting is not supported, the decimated sequence does not obey a recurrence
+    // with few lags, block splitting via jump is cheap instead
+    void jump2(unsigned int s) {
+      if (s < 64) {
+        jump(1ull << s);
+        return;
+      }
+      // the final B steps are done one by one as in jump
+      polynomial_jump(ring().power2(s, B), 0ull - B);
+      for (unsigned int i{0}; i < B; ++i)
+        step();
+    }
+
+    void jump(unsigned long long n) {
+      // jumping ahead via polynomial arithmetic costs about B^2 / 2 operations, the final
+      // B steps are done one by one to fill the whole ring buffer
+      if (n / B > B) {
+        polynomial_jump(ring().power(n - B), n - B);
+        n = B;
       }
       for (unsigned long long i{0}; i < n; ++i)
         step();
@@ -216,6 +209,30 @@ namespace trng {
     }
 
     // Other useful methods
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    void generate(OutputIt first, OutputIt last) {
+      constexpr auto mask_B{int_math::mask(static_cast<decltype(S.index)>(B))};
+      auto i{S.index};
+      while (first != last) {
+        i = (i + 1) & mask_B;
+        if (i < B) {
+          S.r[i] = S.r[(i - A) & mask_B] ^ S.r[(i - B) & mask_B];
+          *first = S.r[i];
+          ++first;
+        } else {
+          // lagged indices do not wrap around until the end of the ring buffer is reached
+          for (;; ++i) {
+            S.r[i] = S.r[i - A] ^ S.r[i - B];
+            *first = S.r[i];
+            if (++first == last or i == mask_B)
+              break;
+          }
+        }
+      }
+      S.index = i;
+    }
+
   private:
     static std::string init_name() {
       std::stringstream name_str;
@@ -236,6 +253,33 @@ namespace trng {
   private:
     status_type S;
 
+    static const GF2_polynomial_ring &ring() {
+      static const GF2_polynomial_ring ring_(B, {B - A, 0});
+      return ring_;
+    }
+
+    // advance the last B values of the ring buffer by n steps, with x^n = sum c_i x^i modulo
+    // the characteristic polynomial of the recurrence the new state is sum c_i F^i(S), where F
+    // denotes a single step, which is evaluated by Horner's scheme, n matters only modulo the
+    // size of the ring buffer
+    void polynomial_jump(const GF2_polynomial_ring::polynomial_type &c, unsigned long long n) {
+      constexpr auto mask{int_math::mask(static_cast<decltype(S.index)>(B))};
+      // the new state is assembled in a heap buffer, for long lags it is too large for the stack
+      const std::unique_ptr<status_type> R_buffer{new status_type()};
+      status_type &R{*R_buffer};
+      // align the ring buffer such that the final index equals the index after n steps
+      R.index = static_cast<unsigned int>((S.index + n - B) & mask);
+      for (unsigned int i{B}; i-- > 0;) {
+        ++R.index;
+        R.index &= mask;
+        R.r[R.index] = R.r[(R.index - A) & mask] ^ R.r[(R.index - B) & mask];
+        if (GF2_polynomial_ring::coefficient(c, i))
+          for (unsigned int j{0}; j < B; ++j)
+            R.r[(R.index - j) & mask] ^= S.r[(S.index - j) & mask];
+      }
+      S = R;
+    }
+
     void step() {
       constexpr auto mask_B{int_math::mask(static_cast<decltype(S.index)>(B))};
       ++S.index;
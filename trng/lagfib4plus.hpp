@@ -38,11 +38,13 @@
 #include <trng/utility.hpp>
 #include <trng/minstd.hpp>
 #include <trng/int_types.hpp>
+#include <trng/linear_algebra.hpp>
 #include <climits>
 #include <stdexcept>
 #include <ostream>
 #include <istream>
 #include <sstream>
+#include <memory>
 #include <ciso646>
 
 namespace trng {
@@ -149,32 +151,28 @@ namespace trng {
       S.index = D - 1;
     }
 
-    void discard(unsigned long long n) {
-      const unsigned int matrix_size = D;
-      using matrix_type = matrix<result_type, matrix_size>;
-      using vector_type = vector<result_type, matrix_size>;
-      using size_type = typename matrix_type::size_type;
-      const unsigned long long n_pivot{int_math::log2_ceil(n) * D * D * D};
-      constexpr auto mask = int_math::mask(D);
-      if (n > n_pivot) {
-        const unsigned long long n_partial{n - matrix_size};
-        matrix_type M;
-        for (size_type i{0}; i < matrix_size - 1; ++i)
-          M(i, i + 1) = 1;
-        M(matrix_size - 1, matrix_size - D) = 1;
-        M(matrix_size - 1, matrix_size - C) = 1;
-        M(matrix_size - 1, matrix_size - B) = 1;
-        M(matrix_size - 1, matrix_size - A) = 1;
-        M = power(M, n_partial);
-        vector_type V;
-        for (size_type i{0}; i < matrix_size; ++i)
-          V(matrix_size - 1 - i) = S.r[(S.index - i) & mask];
-        V = M * V;
-        S.index = static_cast<unsigned int>(S.index + n_partial);
-        S.index &= mask;
-        for (size_type i{0}; i < matrix_size; ++i)
-          S.r[(S.index - i) & mask] = V(matrix_size - 1 - i);
-        n -= n_partial;
+    void discard(unsigned long long n) { jump(n); }
+
+    // Parallel random number generator concept
+    // leapfrog splitting is not supported, the decimated sequence does not obey a recurrence
+    // with few lags, block splitting via jump is cheap instead
+    void jump2(unsigned int s) {
+      if (s < 64) {
+        jump(1ull << s);
+        return;
+      }
+      // the final D steps are done one by one as in jump
+      polynomial_jump(ring().power2(s, D), 0ull - D);
+      for (unsigned int i{0}; i < D; ++i)
+        step();
+    }
+
+    void jump(unsigned long long n) {
+      // jumping ahead via polynomial arithmetic costs about D^2 operations, the final
+      // D steps are done one by one to fill the whole ring buffer
+      if (n / D > D) {
+        polynomial_jump(ring().power(n - D), n - D);
+        n = D;
       }
       for (unsigned long long i{0}; i < n; ++i)
         step();
@@ -216,6 +214,31 @@ namespace trng {
     }
 
     // Other useful methods
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    void generate(OutputIt first, OutputIt last) {
+      constexpr auto mask_D{int_math::mask(static_cast<decltype(S.index)>(D))};
+      auto i{S.index};
+      while (first != last) {
+        i = (i + 1) & mask_D;
+        if (i < D) {
+          S.r[i] = S.r[(i - A) & mask_D] + S.r[(i - B) & mask_D] +
+                   S.r[(i - C) & mask_D] + S.r[(i - D) & mask_D];
+          *first = S.r[i];
+          ++first;
+        } else {
+          // lagged indices do not wrap around until the end of the ring buffer is reached
+          for (;; ++i) {
+            S.r[i] = S.r[i - A] + S.r[i - B] + S.r[i - C] + S.r[i - D];
+            *first = S.r[i];
+            if (++first == last or i == mask_D)
+              break;
+          }
+        }
+      }
+      S.index = i;
+    }
+
   private:
     static std::string init_name() {
       std::stringstream name_str;
@@ -236,6 +259,35 @@ namespace trng {
   private:
     status_type S;
 
+    static const polynomial_ring<result_type> &ring() {
+      static const polynomial_ring<result_type> ring_(D, {D - A, D - B, D - C, 0});
+      return ring_;
+    }
+
+    // advance the last D values of the ring buffer by n steps, with x^n = sum c_i x^i modulo
+    // the characteristic polynomial of the recurrence the new state is sum c_i F^i(S), where F
+    // denotes a single step, which is evaluated by Horner's scheme, n matters only modulo the
+    // size of the ring buffer
+    void polynomial_jump(const typename polynomial_ring<result_type>::polynomial_type &c,
+                         unsigned long long n) {
+      constexpr auto mask{int_math::mask(static_cast<decltype(S.index)>(D))};
+      // the new state is assembled in a heap buffer, for long lags it is too large for the stack
+      const std::unique_ptr<status_type> R_buffer{new status_type()};
+      status_type &R{*R_buffer};
+      // align the ring buffer such that the final index equals the index after n steps
+      R.index = static_cast<unsigned int>((S.index + n - D) & mask);
+      for (unsigned int i{D}; i-- > 0;) {
+        ++R.index;
+        R.index &= mask;
+        R.r[R.index] = R.r[(R.index - A) & mask] + R.r[(R.index - B) & mask] +
+                       R.r[(R.index - C) & mask] + R.r[(R.index - D) & mask];
+        if (c[i] != 0)
+          for (unsigned int j{0}; j < D; ++j)
+            R.r[(R.index - j) & mask] += c[i] * S.r[(S.index - j) & mask];
+      }
+      S = R;
+    }
+
     void step() {
       constexpr auto mask_D{int_math::mask(static_cast<decltype(S.index)>(D))};
       ++S.index;
@@ -78,6 +78,9 @@ namespace trng {
     // compute sum(a^i, i=0..s-1)
     TRNG_CUDA_ENABLE
     static result_type f(result_type s, result_type a);
+    // compute a^(-1) mod 2^64 for odd a
+    TRNG_CUDA_ENABLE
+    static result_type inverse(result_type a);
 
   public:
     // Parameter and status classes
@@ -233,6 +236,9 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt first, OutputIt last);
 
   private:
     parameter_type P;
@@ -261,6 +267,17 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, lcg64>(*this) * x);
   }
 
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void lcg64::generate(OutputIt first, OutputIt last) {
+    const result_type a{P.a}, b{P.b};
+    result_type r{S.r};
+    for (; first != last; ++first) {
+      r = a * r + b;
+      *first = r;
+    }
+    S.r = r;
+  }
+
   // compute floor(log_2(x))
   TRNG_CUDA_ENABLE
   inline unsigned int lcg64::log2_floor(lcg64::result_type x) {
@@ -313,6 +330,16 @@ namespace trng {
     return y;
   }
 
+  // compute a^(-1) mod 2^64 for odd a
+  TRNG_CUDA_ENABLE
+  inline lcg64::result_type lcg64::inverse(lcg64::result_type a) {
+    // a * a = 1 mod 2^3 for odd a, each Newton step doubles the number of correct bits
+    lcg64::result_type x{a};
+    for (int i{0}; i < 5; ++i)
+      x *= 2 - a * x;
+    return x;
+  }
+
   // Parallel random number generator concept
 
   TRNG_CUDA_ENABLE
@@ -355,8 +382,11 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void lcg64::backward() {
-    for (unsigned int i{0}; i < 64; ++i)
-      jump2(i);
+    if ((P.a & 1u) == 1u)
+      S.r = inverse(P.a) * (S.r - P.b);
+    else  // no inverse, go 2^64 - 1 steps ahead
+      for (unsigned int i{0}; i < 64; ++i)
+        jump2(i);
   }
 
 }  // namespace trng
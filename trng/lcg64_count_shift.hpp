@@ -79,6 +79,9 @@ namespace trng {
     // compute sum(a^i, i=0..s-1)
     TRNG_CUDA_ENABLE
     static result_type f(result_type s, result_type a);
+    // compute a^(-1) mod 2^64 for odd a
+    TRNG_CUDA_ENABLE
+    static result_type inverse(result_type a);
     // compute a * b mod m
     TRNG_CUDA_ENABLE
     static result_type mult_modulo(result_type a, result_type b);
@@ -247,6 +250,9 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt first, OutputIt last);
 
   private:
     parameter_type P;
@@ -284,6 +290,25 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, lcg64_count_shift>(*this) * x);
   }
 
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void lcg64_count_shift::generate(OutputIt first, OutputIt last) {
+    const result_type a{P.a}, b{P.b}, inc{P.inc};
+    result_type r{S.r}, count{S.count};
+    for (; first != last; ++first) {
+      r = a * r + b;
+      count += inc;
+      if (count >= modulus)
+        count -= modulus;
+      result_type t{r + count};
+      t ^= (t >> 17u);
+      t ^= (t << 31u);
+      t ^= (t >> 8u);
+      *first = t;
+    }
+    S.r = r;
+    S.count = count;
+  }
+
   // compute floor(log_2(x))
   TRNG_CUDA_ENABLE
   inline unsigned int lcg64_count_shift::log2_floor(lcg64_count_shift::result_type x) {
@@ -339,6 +364,17 @@ namespace trng {
     return y;
   }
 
+  // compute a^(-1) mod 2^64 for odd a
+  TRNG_CUDA_ENABLE
+  inline lcg64_count_shift::result_type lcg64_count_shift::inverse(
+      lcg64_count_shift::result_type a) {
+    // a * a = 1 mod 2^3 for odd a, each Newton step doubles the number of correct bits
+    lcg64_count_shift::result_type x{a};
+    for (int i{0}; i < 5; ++i)
+      x *= 2 - a * x;
+    return x;
+  }
+
   // compute a * b mod m
   TRNG_CUDA_ENABLE
   inline lcg64_count_shift::result_type lcg64_count_shift::mult_modulo(
@@ -420,8 +456,11 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void lcg64_count_shift::backward() {
-    for (unsigned int i{0}; i < 64; ++i)
-      S.r = S.r * pow(P.a, 1ull << i) + f(1ull << i, P.a) * P.b;
+    if ((P.a & 1u) == 1u)
+      S.r = inverse(P.a) * (S.r - P.b);
+    else  // no inverse, go 2^64 - 1 steps ahead
+      for (unsigned int i{0}; i < 64; ++i)
+        S.r = S.r * pow(P.a, 1ull << i) + f(1ull << i, P.a) * P.b;
     S.count += modulus - P.inc;
     if (S.count >= modulus)
       S.count -= modulus;
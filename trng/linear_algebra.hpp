@@ -35,10 +35,14 @@
 #define TRNG_LINEAR_ALGEBRA_HPP
 
 #include <vector>
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <ciso646>
 #include <iostream>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
 #include <trng/utility.hpp>
 #include <trng/int_math.hpp>
 
@@ -282,6 +286,484 @@ namespace trng {
   }
 
 
+  // bit-packed vectors and matrices over GF(2), elements are stored in 64-bit words with the
+  // first element in the most significant bit, matrices are stored row by row
+  template<std::size_t n>
+  class vector<GF2, n> {
+  public:
+    using size_type = std::size_t;
+    using word_type = uint64_t;
+    using const_reference = GF2;
+    static constexpr size_type words = (n + 63) / 64;
+
+    static constexpr word_type bit(size_type i) { return word_type(1) << (63u - i % 64u); }
+
+    class reference {
+      word_type &w;
+      word_type mask;
+
+    public:
+      reference(word_type &w, word_type mask) : w(w), mask(mask) {}
+      reference(const reference &) = default;
+      reference &operator=(const reference &other) { return *this = static_cast<GF2>(other); }
+      reference &operator=(const GF2 x) {
+        if (static_cast<bool>(x))
+          w |= mask;
+        else
+          w &= ~mask;
+        return *this;
+      }
+      operator GF2() const { return GF2((w & mask) != 0); }
+      explicit operator bool() const { return (w & mask) != 0; }
+    };
+
+  private:
+    std::array<word_type, words> data{};
+
+  public:
+    vector() = default;
+
+    template<typename F>
+    explicit vector(F f) {
+      static_assert(trng::utility::is_same<GF2, decltype(f(0))>::value,
+                    "wrong return type of functor");
+      for (size_type i{0}; i < n; ++i)
+        (*this)(i) = f(i);
+    }
+
+    template<typename... Ts>
+    explicit vector(Ts... t) {
+      static_assert(sizeof...(Ts) == n, "wrong number of arguments");
+      static_assert(trng::utility::is_same<GF2, Ts...>::value,
+                    "wrong type in constructor argument");
+      const GF2 values[]{t...};
+      for (size_type i{0}; i < n; ++i)
+        (*this)(i) = values[i];
+    }
+
+    reference operator()(size_type i) { return reference(data[i / 64], bit(i)); }
+    const_reference operator()(size_type i) const { return GF2((data[i / 64] & bit(i)) != 0); }
+    word_type &word(size_type k) { return data[k]; }
+    word_type word(size_type k) const { return data[k]; }
+    constexpr size_type size() const { return n; }
+    bool operator==(const vector &other) const { return data == other.data; }
+    bool operator!=(const vector &other) const { return data != other.data; }
+  };
+
+
+  template<std::size_t n>
+  class matrix<GF2, n> {
+  public:
+    using size_type = std::size_t;
+    using word_type = uint64_t;
+    using reference = typename vector<GF2, n>::reference;
+    using const_reference = GF2;
+    static constexpr size_type words = vector<GF2, n>::words;
+
+  private:
+    std::vector<word_type> data;
+
+    static constexpr word_type bit(size_type j) { return vector<GF2, n>::bit(j); }
+
+  public:
+    matrix() : data(n * words) {}
+
+    template<typename F>
+    explicit matrix(F f) : data(n * words) {
+      static_assert(trng::utility::is_same<GF2, decltype(f(0, 0))>::value,
+                    "wrong return type of functor");
+      for (size_type i{0}; i < n; ++i)
+        for (size_type j{0}; j < n; ++j)
+          (*this)(i, j) = f(i, j);
+    }
+
+    template<typename... Ts>
+    explicit matrix(Ts... t) : data(n * words) {
+      static_assert(sizeof...(Ts) == n * n, "wrong number of arguments");
+      static_assert(trng::utility::is_same<GF2, Ts...>::value,
+                    "wrong type in constructor argument");
+      const GF2 values[]{t...};
+      for (size_type i{0}; i < n; ++i)
+        for (size_type j{0}; j < n; ++j)
+          (*this)(i, j) = values[j + i * n];
+    }
+
+    reference operator()(size_type i, size_type j) {
+      return reference(data[j / 64 + i * words], bit(j));
+    }
+    const_reference operator()(size_type i, size_type j) const {
+      return GF2((data[j / 64 + i * words] & bit(j)) != 0);
+    }
+    word_type &word(size_type i, size_type k) { return data[k + i * words]; }
+    word_type word(size_type i, size_type k) const { return data[k + i * words]; }
+    constexpr size_type size() const { return n; }
+    bool operator==(const matrix &other) const { return data == other.data; }
+    bool operator!=(const matrix &other) const { return data != other.data; }
+  };
+
+
+  template<std::size_t n>
+  vector<GF2, n> operator+(const vector<GF2, n> &a, const vector<GF2, n> &b) {
+    vector<GF2, n> res;
+    for (std::size_t k{0}; k < vector<GF2, n>::words; ++k)
+      res.word(k) = a.word(k) ^ b.word(k);
+    return res;
+  }
+
+
+  template<std::size_t n>
+  matrix<GF2, n> operator+(const matrix<GF2, n> &a, const matrix<GF2, n> &b) {
+    matrix<GF2, n> res;
+    for (std::size_t i{0}; i < n; ++i)
+      for (std::size_t k{0}; k < matrix<GF2, n>::words; ++k)
+        res.word(i, k) = a.word(i, k) ^ b.word(i, k);
+    return res;
+  }
+
+
+  // each element of the result is the parity of a row of a masked by b
+  template<std::size_t n>
+  vector<GF2, n> operator*(const matrix<GF2, n> &a, const vector<GF2, n> &b) {
+    using word_type = typename vector<GF2, n>::word_type;
+    vector<GF2, n> res;
+    for (std::size_t i{0}; i < n; ++i) {
+      word_type sum{0};
+      for (std::size_t k{0}; k < matrix<GF2, n>::words; ++k)
+        sum ^= a.word(i, k) & b.word(k);
+      if ((int_math::popcount(sum) & 1) == 1)
+        res.word(i / 64) |= vector<GF2, n>::bit(i);
+    }
+    return res;
+  }
+
+
+  // each row of the result is the sum of those rows of b that are selected by the
+  // corresponding row of a
+  template<std::size_t n>
+  matrix<GF2, n> operator*(const matrix<GF2, n> &a, const matrix<GF2, n> &b) {
+    using word_type = typename matrix<GF2, n>::word_type;
+    constexpr std::size_t words{matrix<GF2, n>::words};
+    matrix<GF2, n> res;
+    for (std::size_t i{0}; i < n; ++i)
+      for (std::size_t k0{0}; k0 < words; ++k0) {
+        const word_type a_ik0{a.word(i, k0)};
+        for (std::size_t k{64 * k0}, k_end{utility::min(n, 64 * k0 + 64)}; k < k_end; ++k)
+          if ((a_ik0 & vector<GF2, n>::bit(k)) != 0)
+            for (std::size_t j{0}; j < words; ++j)
+              res.word(i, j) ^= b.word(k, j);
+      }
+    return res;
+  }
+
+
+  // residues of polynomials over GF(2) modulo a polynomial
+  // p(x) = x^degree + x^e_1 + ... + x^e_k, coefficients are bit-packed into 64-bit words,
+  // the coefficient of x^i is stored in bit i % 64 of word i / 64
+  class GF2_polynomial_ring {
+  public:
+    using word_type = uint64_t;
+    using polynomial_type = std::vector<word_type>;
+
+    // p is given by its degree and the exponents e_1, ..., e_k of the lower non-zero terms,
+    // suitable for sparse polynomials
+    GF2_polynomial_ring(unsigned int degree, std::vector<unsigned int> exponents)
+        : degree{degree}, exponents(std::move(exponents)), words{degree / 64 + 1} {
+      modulus.resize(words);
+      set(modulus, degree);
+      for (auto e : this->exponents)
+        set(modulus, e);
+    }
+
+    // p is given by its bit-packed coefficients, suitable for dense polynomials
+    explicit GF2_polynomial_ring(polynomial_type p) : modulus(std::move(p)) {
+      std::size_t i{64 * modulus.size()};
+      while (i > 0 and not coefficient(modulus, i - 1))
+        --i;
+      if (i == 0)
+        throw std::invalid_argument("zero polynomial");
+      degree = static_cast<unsigned int>(i - 1);
+      words = degree / 64 + 1;
+      modulus.resize(words);
+      // copies of p shifted by 0, ..., 63 bits allow to reduce word-wise
+      shifted.resize(64);
+      for (unsigned int b{0}; b < 64; ++b) {
+        shifted[b].resize(words + 1);
+        for (std::size_t k{0}; k < words; ++k) {
+          shifted[b][k] ^= modulus[k] << b;
+          if (b > 0)
+            shifted[b][k + 1] ^= modulus[k] >> (64u - b);
+        }
+      }
+    }
+
+    static bool coefficient(const polynomial_type &a, std::size_t i) {
+      return ((a[i / 64] >> (i % 64)) & 1u) == 1u;
+    }
+
+    unsigned int get_degree() const { return degree; }
+
+    // compute x^n mod p by repeated squaring
+    polynomial_type power(unsigned long long n) const {
+      return power_bits(63, [n](unsigned int i) { return ((n >> i) & 1u) == 1u; });
+    }
+
+    // compute x^(2^s - n) mod p for n <= 2^s, the exponent may exceed 64 bits
+    polynomial_type power2(unsigned int s, unsigned long long n) const {
+      if (s < 64)
+        return power((1ull << s) - n);
+      // 2^s - n = (2^s - 2^64) + (2^64 - n) for n > 0
+      const unsigned long long low{0ull - n};
+      return power_bits(s, [s, n, low](unsigned int i) {
+        return i < 64 ? ((low >> i) & 1u) == 1u : (n == 0 ? i == s : i < s);
+      });
+    }
+
+    // squaring is linear over GF(2), the coefficient of x^i moves to x^(2i)
+    void square(polynomial_type &a) const {
+      polynomial_type b(2 * words);
+      for (std::size_t k{0}; k < words; ++k) {
+        b[2 * k] = spread(static_cast<uint32_t>(a[k]));
+        b[2 * k + 1] = spread(static_cast<uint32_t>(a[k] >> 32u));
+      }
+      reduce(b);
+      a.swap(b);
+    }
+
+    void times_x(polynomial_type &a) const {
+      for (std::size_t k{words - 1}; k > 0; --k)
+        a[k] = (a[k] << 1u) | (a[k - 1] >> 63u);
+      a[0] <<= 1u;
+      reduce(a);
+    }
+
+    // multiplication by the inverse of x, requires a non-zero constant term of p
+    void times_x_inverse(polynomial_type &a) const {
+      if (coefficient(a, 0))
+        for (std::size_t k{0}; k < words; ++k)
+          a[k] ^= modulus[k];
+      for (std::size_t k{0}; k + 1 < words; ++k)
+        a[k] = (a[k] >> 1u) | (a[k + 1] << 63u);
+      a[words - 1] >>= 1u;
+    }
+
+  private:
+    // compute x^e mod p by repeated squaring, where bit(i) gives the i-th bit of e and all bits
+    // above top are zero
+    template<typename bit_t>
+    polynomial_type power_bits(unsigned int top, bit_t bit) const {
+      polynomial_type res(words);
+      res[0] = 1;
+      long i{static_cast<long>(top)};
+      while (i >= 0 and not bit(static_cast<unsigned int>(i)))
+        --i;
+      for (; i >= 0; --i) {
+        square(res);
+        if (bit(static_cast<unsigned int>(i)))
+          times_x(res);
+      }
+      return res;
+    }
+
+    unsigned int degree;
+    std::vector<unsigned int> exponents;
+    std::size_t words;
+    polynomial_type modulus;
+    std::vector<polynomial_type> shifted;
+
+    static void set(polynomial_type &a, std::size_t i) {
+      a[i / 64] ^= word_type(1) << (i % 64);
+    }
+
+    // insert a zero bit after each bit of x
+    static word_type spread(uint32_t x) {
+      word_type y{x};
+      y = (y | (y << 16u)) & 0x0000ffff0000ffffu;
+      y = (y | (y << 8u)) & 0x00ff00ff00ff00ffu;
+      y = (y | (y << 4u)) & 0x0f0f0f0f0f0f0f0fu;
+      y = (y | (y << 2u)) & 0x3333333333333333u;
+      y = (y | (y << 1u)) & 0x5555555555555555u;
+      return y;
+    }
+
+    // eliminate all terms of degree degree or higher from high to low
+    void reduce(polynomial_type &a) const {
+      if (shifted.empty()) {
+        for (std::size_t i{64 * a.size()}; i-- > degree;)
+          if (coefficient(a, i)) {
+            set(a, i);
+            for (auto e : exponents)
+              set(a, i - degree + e);
+          }
+      } else {
+        for (std::size_t i{64 * a.size()}; i-- > degree;)
+          if (coefficient(a, i)) {
+            const std::size_t t{i - degree}, k0{t / 64};
+            const polynomial_type &p{shifted[t % 64]};
+            for (std::size_t k{0}, k_end{utility::min(words + 1, a.size() - k0)}; k < k_end;
+                 ++k)
+              a[k0 + k] ^= p[k];
+          }
+      }
+      a.resize(words);
+    }
+  };
+
+
+  // minimal polynomial of the linearly recurrent sequence s_0, ..., s_{n - 1} over GF(2),
+  // which is bit-packed as in GF2_polynomial_ring, by the Berlekamp-Massey algorithm
+  inline GF2_polynomial_ring::polynomial_type GF2_minimal_polynomial(
+      const GF2_polynomial_ring::polynomial_type &s, std::size_t n) {
+    using word_type = GF2_polynomial_ring::word_type;
+    using polynomial_type = GF2_polynomial_ring::polynomial_type;
+    const std::size_t words{n / 64 + 2};
+    // the sequence in reverse order, such that the discrepancy becomes a word-wise product
+    polynomial_type r(words + 1);
+    for (std::size_t i{0}; i < n; ++i)
+      if (GF2_polynomial_ring::coefficient(s, i))
+        r[(n - 1 - i) / 64] |= word_type(1) << ((n - 1 - i) % 64);
+    // bits o, ..., o + 63 of r
+    const auto extract{[&r](std::size_t o) {
+      const std::size_t k{o / 64}, b{o % 64};
+      return b == 0 ? r[k] : (r[k] >> b) | (r[k + 1] << (64u - b));
+    }};
+    // C is the connection polynomial, B its value before the last length change
+    polynomial_type C(words + 1), B(words + 1);
+    C[0] = B[0] = 1;
+    std::size_t L{0}, m{1};
+    for (std::size_t k{0}; k < n; ++k) {
+      const std::size_t o{n - 1 - k};
+      word_type d{0};
+      for (std::size_t j{0}; j <= L / 64 and o + 64 * j < 64 * words; ++j)
+        d ^= C[j] & extract(o + 64 * j);
+      if ((int_math::popcount(d) & 1) == 0) {
+        ++m;
+        continue;
+      }
+      const polynomial_type T{2 * L <= k ? C : polynomial_type()};
+      // C <- C + x^m B
+      const std::size_t k0{m / 64}, b{m % 64};
+      for (std::size_t j{0}; j + k0 < C.size(); ++j) {
+        C[j + k0] ^= B[j] << b;
+        if (b > 0 and j + k0 + 1 < C.size())
+          C[j + k0 + 1] ^= B[j] >> (64u - b);
+      }
+      if (2 * L <= k) {
+        L = k + 1 - L;
+        B = T;
+        m = 1;
+      } else
+        ++m;
+    }
+    // the minimal polynomial is the reciprocal of the connection polynomial
+    polynomial_type p(L / 64 + 1);
+    for (std::size_t i{0}; i <= L; ++i)
+      if (GF2_polynomial_ring::coefficient(C, i))
+        p[(L - i) / 64] |= word_type(1) << ((L - i) % 64);
+    return p;
+  }
+
+
+  // residues of polynomials with coefficients of an unsigned integer type T, i.e., modulo
+  // 2^w for w-bit integers, modulo the sparse polynomial p(x) = x^degree - x^e_1 - ... - x^e_k
+  template<typename T>
+  class polynomial_ring {
+    static_assert(std::is_unsigned<T>::value, "coefficient type must be unsigned");
+
+  public:
+    using polynomial_type = std::vector<T>;
+
+    // p is given by its degree and the exponents e_1, ..., e_k of the lower non-zero terms
+    polynomial_ring(unsigned int degree, std::vector<unsigned int> exponents)
+        : degree{degree}, exponents(std::move(exponents)) {}
+
+    // compute x^n mod p by repeated squaring
+    polynomial_type power(unsigned long long n) const {
+      return power_bits(63, [n](unsigned int i) { return ((n >> i) & 1u) == 1u; });
+    }
+
+    // compute x^(2^s - n) mod p for n <= 2^s, the exponent may exceed 64 bits
+    polynomial_type power2(unsigned int s, unsigned long long n) const {
+      if (s < 64)
+        return power((1ull << s) - n);
+      // 2^s - n = (2^s - 2^64) + (2^64 - n) for n > 0
+      const unsigned long long low{0ull - n};
+      return power_bits(s, [s, n, low](unsigned int i) {
+        return i < 64 ? ((low >> i) & 1u) == 1u : (n == 0 ? i == s : i < s);
+      });
+    }
+
+  private:
+    unsigned int degree;
+    std::vector<unsigned int> exponents;
+
+    // compute x^e mod p by repeated squaring, where bit(i) gives the i-th bit of e and all bits
+    // above top are zero
+    template<typename bit_t>
+    polynomial_type power_bits(unsigned int top, bit_t bit) const {
+      polynomial_type res(degree);
+      res[0] = 1;
+      polynomial_type scratch(6 * degree + 64);
+      long i{static_cast<long>(top)};
+      while (i >= 0 and not bit(static_cast<unsigned int>(i)))
+        --i;
+      for (; i >= 0; --i) {
+        polynomial_type res_2(2 * degree);
+        square(res.data(), degree, res_2.data(), scratch.data());
+        reduce(res_2);
+        res.swap(res_2);
+        if (bit(static_cast<unsigned int>(i))) {
+          res.insert(res.begin(), T(0));
+          reduce(res);
+        }
+      }
+      return res;
+    }
+
+    // res[0], ..., res[2 n - 1] become the coefficients of the square of the polynomial with
+    // coefficients a[0], ..., a[n - 1], Karatsuba's method with schoolbook multiplication for
+    // short polynomials, the scratch space must hold at least 6 n + 64 elements
+    static void square(const T *a, std::size_t n, T *res, T *scratch) {
+      if (n <= 32) {
+        std::fill(res, res + 2 * n, T(0));
+        for (std::size_t i{0}; i < n; ++i) {
+          res[2 * i] += a[i] * a[i];
+          const T a_i_2{static_cast<T>(2u * a[i])};
+          for (std::size_t j{i + 1}; j < n; ++j)
+            res[i + j] += a_i_2 * a[j];
+        }
+        return;
+      }
+      // split into a = a_0 + a_1 x^h, the mixed term 2 a_0 a_1 equals
+      // (a_0 + a_1)^2 - a_0^2 - a_1^2
+      const std::size_t h{n / 2}, m{n - h};
+      square(a, h, res, scratch);
+      square(a + h, m, res + 2 * h, scratch);
+      T *const s{scratch}, *const t{scratch + m};
+      for (std::size_t i{0}; i < m; ++i)
+        s[i] = (i < h ? a[i] : T(0)) + a[h + i];
+      square(s, m, t, scratch + 3 * m);
+      for (std::size_t i{0}; i < 2 * h; ++i)
+        t[i] -= res[i];
+      for (std::size_t i{0}; i < 2 * m; ++i)
+        t[i] -= res[2 * h + i];
+      for (std::size_t i{0}; i < 2 * m; ++i)
+        res[h + i] += t[i];
+    }
+
+    // eliminate all terms of degree degree or higher from high to low
+    void reduce(polynomial_type &a) const {
+      for (std::size_t i{a.size()}; i-- > degree;)
+        if (a[i] != 0) {
+          const T c{a[i]};
+          a[i] = 0;
+          for (auto e : exponents)
+            a[i - degree + e] += c;
+        }
+      a.resize(degree);
+    }
+  };
+
+
 }  // namespace trng
 
 #endif
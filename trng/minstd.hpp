@@ -151,6 +151,9 @@ namespace trng {
     // Other useful methods
     static const char *name();
     long operator()(long);
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    void generate(OutputIt first, OutputIt last);
 
   private:
     status_type S;
@@ -184,6 +187,19 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, minstd>(*this) * x);
   }
 
+  template<typename OutputIt>
+  void minstd::generate(OutputIt first, OutputIt last) {
+    uint64_t r{S.r};
+    for (; first != last; ++first) {
+      r *= static_cast<uint64_t>(16807);
+      r = (r & 0x7fffffffu) + (r >> 31u);
+      if (r >= 2147483647u)
+        r -= 2147483647u;
+      *first = static_cast<result_type>(r);
+    }
+    S.r = static_cast<result_type>(r);
+  }
+
 }  // namespace trng
 
 #endif
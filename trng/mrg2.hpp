@@ -139,6 +139,12 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt first, OutputIt last);
+
+    template<typename, int>
+    friend class simd_mrg;
 
   private:
     parameter_type P;
@@ -172,6 +178,21 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, mrg2>(*this) * x);
   }
 
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void mrg2::generate(OutputIt first, OutputIt last) {
+    const result_type a0{P.a[0]}, a1{P.a[1]};
+    result_type r0{S.r[0]}, r1{S.r[1]};
+    for (; first != last; ++first) {
+      const uint64_t t{static_cast<uint64_t>(a0) * static_cast<uint64_t>(r0) +
+                       static_cast<uint64_t>(a1) * static_cast<uint64_t>(r1)};
+      r1 = r0;
+      r0 = int_math::modulo<modulus, 2>(t);
+      *first = r0;
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+  }
+
   // Parallel random number generator concept
   TRNG_CUDA_ENABLE
   inline void mrg2::split(unsigned int s, unsigned int n) {
@@ -207,6 +228,14 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void mrg2::jump2(unsigned int s) {
+#if !(defined TRNG_CUDA)
+    if (s < 64) {
+      const auto T{P.jump_table(modulus)};
+      const result_type r[2]{S.r[0], S.r[1]};
+      int_math::matrix_vec_mult<2>(T->A[s], r, S.r, modulus);
+      return;
+    }
+#endif
     result_type b[4], c[4]{};
     b[0] = P.a[0];
     b[1] = P.a[1];
@@ -235,6 +264,18 @@ namespace trng {
       for (unsigned int i{0}; i < s; ++i)
         step();
     } else {
+#if !(defined TRNG_CUDA)
+      const auto T{P.jump_table(modulus)};
+      unsigned int i{0};
+      while (s > 0) {
+        if (s % 2 == 1) {
+          const result_type r[2]{S.r[0], S.r[1]};
+          int_math::matrix_vec_mult<2>(T->A[i], r, S.r, modulus);
+        }
+        ++i;
+        s >>= 1u;
+      }
+#else
       unsigned int i{0};
       while (s > 0) {
         if (s % 2 == 1)
@@ -242,6 +283,7 @@ namespace trng {
         ++i;
         s >>= 1u;
       }
+#endif
     }
   }
 
@@ -33,9 +33,15 @@
 #if !(defined TRNG_MRG_PARAMETER_HPP)
 #define TRNG_MRG_PARAMETER_HPP
 
+#include <trng/cuda.hpp>
+#include <trng/int_types.hpp>
+#include <trng/int_math.hpp>
 #include <ostream>
 #include <istream>
 #include <algorithm>
+#if !(defined TRNG_CUDA)
+#include <atomic>
+#endif
 
 namespace trng {
 
@@ -63,6 +69,71 @@ namespace trng {
     }
 
     friend F;
+    template<typename, int>
+    friend class simd_mrg;
+
+#if !(defined TRNG_CUDA)
+    // powers A^(2^i), i = 0, ..., 63, of the companion matrix A of the recurrence with the
+    // coefficients a
+    struct jump_table_type {
+      result_type a[n];
+      int32_t A[64][n * n];
+    };
+
+    // returns the powers of the companion matrix modulo m, a table is computed once per set of
+    // coefficients and kept in a cache that is shared by all parameter objects of the engine
+    // and does not add any state to the parameter object, the cache is an open-addressing hash
+    // table of atomic pointers to immutable tables that live until the end of the program,
+    // neither a lookup nor an insertion takes a lock
+    const jump_table_type *jump_table(int32_t m) const {
+      static constexpr std::size_t slots{1024}, max_probes{16};
+      static std::atomic<jump_table_type *> cache[slots];
+      uint64_t h{0};
+      for (int j{0}; j < n; ++j)
+        h = (h ^ static_cast<uint64_t>(a[j])) * 0x9e3779b97f4a7c15ull;
+      h ^= h >> 32u;
+      jump_table_type *T_new{nullptr};
+      for (std::size_t k{0}; k < max_probes; ++k) {
+        std::atomic<jump_table_type *> &slot{cache[(h + k) % slots]};
+        jump_table_type *T{slot.load(std::memory_order_acquire)};
+        if (T == nullptr) {
+          if (T_new == nullptr)
+            T_new = fill_jump_table(new jump_table_type, m);
+          if (slot.compare_exchange_strong(T, T_new, std::memory_order_acq_rel,
+                                           std::memory_order_acquire))
+            return T_new;
+          // T is the table that another thread has published in this slot meanwhile
+        }
+        if (std::equal(a, a + n, T->a)) {
+          delete T_new;
+          return T;
+        }
+      }
+      // no free slot, e.g., after splitting into very many streams, a thread-local table
+      // serves the current jump
+      static thread_local jump_table_type T_local;
+      if (T_new == nullptr)
+        return fill_jump_table(&T_local, m);
+      T_local = *T_new;
+      delete T_new;
+      return &T_local;
+    }
+
+  private:
+    jump_table_type *fill_jump_table(jump_table_type *T, int32_t m) const {
+      std::copy(a, a + n, T->a);
+      std::fill(&T->A[0][0], &T->A[0][0] + n * n, int32_t(0));
+      for (int j{0}; j < n; ++j)
+        T->A[0][j] = a[j];
+      for (int j{1}; j < n; ++j)
+        T->A[0][j * n + j - 1] = 1;
+      for (int j{1}; j < 64; ++j)
+        int_math::matrix_mult<n>(T->A[j - 1], T->A[j - 1], T->A[j], m);
+      return T;
+    }
+
+  public:
+#endif
 
     // Equality comparable concept
     friend bool operator==(const mrg_parameter &P1, const mrg_parameter &P2) {
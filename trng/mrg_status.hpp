@@ -67,6 +67,8 @@ namespace trng {
     }
 
     friend F;
+    template<typename, int>
+    friend class simd_mrg;
 
     // Equality comparable concept
     friend bool operator==(const mrg_status &S1, const mrg_status &S2) {
@@ -31,6 +31,9 @@
 // OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "mt19937.hpp"
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 namespace trng {
 
@@ -80,6 +83,103 @@ namespace trng {
 
   bool operator!=(const mt19937 &R1, const mt19937 &R2) { return not(R1 == R2); }
 
+  // Parallel random number generator concept
+
+  const GF2_polynomial_ring &mt19937::ring() {
+    static const GF2_polynomial_ring p([]() {
+      // the most significant bits of successive words form a linearly recurrent sequence,
+      // its minimal polynomial is the characteristic polynomial of the recurrence
+      constexpr std::size_t n{2 * (std::numeric_limits<result_type>::digits * N - 31)};
+      mt19937 R;
+      GF2_polynomial_ring::polynomial_type s(n / 64 + 1);
+      for (std::size_t i{0}; i < n; ++i) {
+        if (R.S.mti >= N)
+          R.twist();
+        const result_type x{R.S.mt[R.S.mti++]};
+        if ((x >> (std::numeric_limits<result_type>::digits - 1)) == 1)
+          s[i / 64] |= GF2_polynomial_ring::word_type(1) << (i % 64);
+      }
+      return GF2_polynomial_ring(GF2_minimal_polynomial(s, n));
+    }());
+    return p;
+  }
+
+  const GF2_polynomial_ring::polynomial_type &mt19937::jump_polynomial(unsigned int i) {
+    static const std::vector<GF2_polynomial_ring::polynomial_type> x_powers([]() {
+      std::vector<GF2_polynomial_ring::polynomial_type> x(64);
+      x[0] = ring().power(1);
+      for (std::size_t k{1}; k < x.size(); ++k) {
+        x[k] = x[k - 1];
+        ring().square(x[k]);
+      }
+      return x;
+    }());
+    return x_powers[i];
+  }
+
+  void mt19937::polynomial_jump(const GF2_polynomial_ring::polynomial_type &c) {
+    const result_type mag01[2]{0u, 0x9908b0dfu};
+    // the words of the sequence, the current block starts at index i, the sum is
+    // evaluated by Horner's scheme
+    std::vector<result_type> R(4 * N);
+    std::size_t i{0};
+    for (unsigned int k{ring().get_degree()}; k-- > 0;) {
+      const result_type x{(R[i] & UM) | (R[i + 1] & LM)};
+      R[i + N] = R[i + M] ^ (x >> 1u) ^ mag01[static_cast<int>(x & 1u)];
+      ++i;
+      if (i + N == R.size()) {
+        std::copy(R.begin() + i, R.end(), R.begin());
+        i = 0;
+      }
+      if (GF2_polynomial_ring::coefficient(c, k))
+        for (int j{0}; j < N; ++j)
+          R[i + j] ^= S.mt[j];
+    }
+    std::copy(R.begin() + i, R.begin() + i + N, S.mt);
+  }
+
+  void mt19937::jump(unsigned long long n) {
+    if (n == 0)
+      return;
+    // n values are consumed after T twists, at index mti_new of the final block, jumping
+    // via polynomial arithmetic costs about as much as 2^14 twists
+    const unsigned long long r{(n - 1) % N + static_cast<unsigned long long>(S.mti)};
+    unsigned long long T{(n - 1) / N + r / N};
+    const int mti_new{static_cast<int>(r % N) + 1};
+    if (T > (1ull << 14u)) {
+      // the polynomial jump does not determine the least significant bits of the first word
+      // of the block, which are not part of the state of the recurrence, the final twist
+      // computes a complete block
+      polynomial_jump(ring().power(N * (T - 1)));
+      T = 1;
+    }
+    for (; T > 0; --T)
+      twist();
+    S.mti = mti_new;
+  }
+
+  void mt19937::jump2(unsigned int s) {
+    if (s < 64 and (1ull << s) / N <= (1ull << 14u)) {
+      jump(1ull << s);
+      return;
+    }
+    // 2^s values are consumed after T twists, at index mti_new of the final block with
+    // N (T - 1) = 2^s + mti - mti_new - N, the cached polynomial x^(2^s) is multiplied by
+    // the remaining negative power of x
+    unsigned long long r{1};
+    for (unsigned int k{0}; k < s; ++k)
+      r = (2 * r) % N;
+    const int mti_new{static_cast<int>(((r + N - 1) % N + S.mti) % N) + 1};
+    GF2_polynomial_ring::polynomial_type c{jump_polynomial(utility::min(s, 63u))};
+    for (unsigned int k{63}; k < s; ++k)
+      ring().square(c);
+    for (int d{S.mti - mti_new - N}; d < 0; ++d)
+      ring().times_x_inverse(c);
+    polynomial_jump(c);
+    twist();
+    S.mti = mti_new;
+  }
+
   // Other useful methods
   const char *const mt19937::name_str = "mt19937";
 
@@ -52,6 +52,7 @@
 #include <trng/int_types.hpp>
 #include <trng/utility.hpp>
 #include <trng/generate_canonical.hpp>
+#include <trng/linear_algebra.hpp>
 #include <climits>
 #include <stdexcept>
 #include <ostream>
@@ -180,6 +181,10 @@ namespace trng {
 
     void discard(unsigned long long);
 
+    // Parallel random number generator concept
+    void jump2(unsigned int);
+    void jump(unsigned long long);
+
     // Equality comparable concept
     friend bool operator==(const mt19937_64 &, const mt19937_64 &);
     friend bool operator!=(const mt19937_64 &, const mt19937_64 &);
@@ -216,33 +221,47 @@ namespace trng {
     // Other useful methods
     static const char *name();
     long operator()(long);
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    void generate(OutputIt first, OutputIt last);
 
   private:
     parameter_type P;
     status_type S;
     static const char *const name_str;
+
+    // generate N words at one time
+    void twist();
+    static result_type temper(result_type x);
+
+    // characteristic polynomial of the recurrence that generates one word after another
+    static const GF2_polynomial_ring &ring();
+    // returns x^(2^i) modulo the characteristic polynomial for i < 64
+    static const GF2_polynomial_ring::polynomial_type &jump_polynomial(unsigned int i);
+    // advance the current block of N words by sum c_i x^i steps of the recurrence
+    void polynomial_jump(const GF2_polynomial_ring::polynomial_type &c);
   };
 
   // Inline and template methods
 
-  inline mt19937_64::result_type mt19937_64::operator()() {
+  inline void mt19937_64::twist() {
     const result_type mag01[2]{0u, 0xB5026F5AA96619E9u};
-    if (S.mti >= mt19937_64::N) {  // generate N words at one time
-      int i{0};
-      for (; i < mt19937_64::N - mt19937_64::M; ++i) {
-        const result_type x{(S.mt[i] & mt19937_64::UM) | (S.mt[i + 1] & mt19937_64::LM)};
-        S.mt[i] = S.mt[i + mt19937_64::M] ^ (x >> 1u) ^ mag01[static_cast<int>(x & 1u)];
-      }
-      for (; i < mt19937_64::N - 1; ++i) {
-        const result_type x{(S.mt[i] & mt19937_64::UM) | (S.mt[i + 1] & mt19937_64::LM)};
-        S.mt[i] = S.mt[i + (mt19937_64::M - mt19937_64::N)] ^ (x >> 1u) ^
-                  mag01[static_cast<int>(x & 1u)];
-      }
-      const result_type x{(S.mt[mt19937_64::N - 1] & UM) | (S.mt[0] & LM)};
-      S.mt[N - 1] = S.mt[mt19937_64::M - 1] ^ (x >> 1u) ^ mag01[static_cast<int>(x & 1u)];
-      S.mti = 0;
+    int i{0};
+    for (; i < mt19937_64::N - mt19937_64::M; ++i) {
+      const result_type x{(S.mt[i] & mt19937_64::UM) | (S.mt[i + 1] & mt19937_64::LM)};
+      S.mt[i] = S.mt[i + mt19937_64::M] ^ (x >> 1u) ^ mag01[static_cast<int>(x & 1u)];
     }
-    result_type x{S.mt[S.mti++]};
+    for (; i < mt19937_64::N - 1; ++i) {
+      const result_type x{(S.mt[i] & mt19937_64::UM) | (S.mt[i + 1] & mt19937_64::LM)};
+      S.mt[i] = S.mt[i + (mt19937_64::M - mt19937_64::N)] ^ (x >> 1u) ^
+                mag01[static_cast<int>(x & 1u)];
+    }
+    const result_type x{(S.mt[mt19937_64::N - 1] & UM) | (S.mt[0] & LM)};
+    S.mt[N - 1] = S.mt[mt19937_64::M - 1] ^ (x >> 1u) ^ mag01[static_cast<int>(x & 1u)];
+    S.mti = 0;
+  }
+
+  inline mt19937_64::result_type mt19937_64::temper(result_type x) {
     x ^= (x >> 29u) & 0x5555555555555555u;
     x ^= (x << 17u) & 0x71D67FFFEDA60000u;
     x ^= (x << 37u) & 0xFFF7EEE000000000u;
@@ -250,15 +269,33 @@ namespace trng {
     return x;
   }
 
-  inline void mt19937_64::discard(unsigned long long n) {
-    for (unsigned long long i{0}; i < n; ++i)
-      this->operator()();
+  inline mt19937_64::result_type mt19937_64::operator()() {
+    if (S.mti >= N)
+      twist();
+    return temper(S.mt[S.mti++]);
   }
 
+  inline void mt19937_64::discard(unsigned long long n) { jump(n); }
+
   inline long mt19937_64::operator()(long x) {
     return static_cast<long>(utility::uniformco<double, mt19937_64>(*this) * x);
   }
 
+  template<typename OutputIt>
+  void mt19937_64::generate(OutputIt first, OutputIt last) {
+    int i{S.mti};
+    while (first != last) {
+      if (i >= N) {
+        twist();
+        i = 0;
+      }
+      // temper the remaining words of the current block
+      for (; i < N and first != last; ++i, ++first)
+        *first = temper(S.mt[i]);
+    }
+    S.mti = i;
+  }
+
 }  // namespace trng
 
 #endif
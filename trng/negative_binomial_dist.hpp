@@ -45,6 +45,7 @@
 #include <vector>
 #include <algorithm>
 #include <numeric>
+#include <iterator>
 #include <ciso646>
 
 namespace trng {
@@ -59,17 +60,19 @@ namespace trng {
       double p_{0};
       double r_{0};
       std::vector<double> P_;
+      // guide table for fast lookup in P_
+      utility::discrete_guide_type guide_;
 
       // probability density function
       double pdf(int x) const {
         if (x < 0)
           return 0;
-        std::vector<double> terms{math::ln_Gamma(r_ + x), -math::ln_Gamma(r_),
-                                  -math::ln_Gamma(static_cast<double>(x + 1)),
-                                  +math::ln(p_) * r_, math::ln1p(-p_) * x};
-        std::sort(terms.begin(), terms.end(),
+        double terms[]{math::ln_Gamma(r_ + x), -math::ln_Gamma(r_),
+                       -math::ln_Gamma(static_cast<double>(x + 1)), +math::ln(p_) * r_,
+                       math::ln1p(-p_) * x};
+        std::sort(std::begin(terms), std::end(terms),
                   [](double a, double b) { return math::abs(a) < math::abs(b); });
-        return math::exp(std::accumulate(terms.begin(), terms.end(), 0.0));
+        return math::exp(std::accumulate(std::begin(terms), std::end(terms), 0.0));
       }
 
       // cumulative density function
@@ -81,6 +84,7 @@ namespace trng {
 
       void calc_probabilities() {
         P_ = std::vector<double>();
+        guide_ = utility::discrete_guide_type();
         int x{0};
         double p{0.0};
         while (p < 1.0 - 1.0 / 4096.0) {
@@ -89,6 +93,8 @@ namespace trng {
           ++x;
         }
         P_.push_back(1);
+
+        guide_ = utility::discrete_guide(P_.begin(), P_.end());
       }
 
     public:
@@ -119,22 +125,12 @@ namespace trng {
     // random numbers
     template<typename R>
     int operator()(R &r) {
-      double p{utility::uniformco<double>(r)};
-      const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end())};
-      int x_i{static_cast<int>(x)};
-      if (x + 1 == P.P_.size()) {
-        p -= cdf(x_i);
-        while (p > 0) {
-          ++x_i;
-          p -= pdf(x_i);
-        }
-      }
-      return x_i;
+      return sample(r, P);
     }
+    // samples directly from the given parameter, neither copies nor allocates memory
     template<typename R>
     int operator()(R &r, const param_type &p) {
-      negative_binomial_dist g(p);
-      return g(r);
+      return sample(r, p);
     }
     // property methods
     int min() const { return 0; }
@@ -149,6 +145,22 @@ namespace trng {
     double pdf(int x) const { return P.pdf(x); }
     // cumulative density function
     double cdf(int x) const { return P.cdf(x); }
+
+  private:
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      double p{utility::uniformco<double>(r)};
+      const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end(), P.guide_)};
+      int x_i{static_cast<int>(x)};
+      if (x + 1 == P.P_.size()) {
+        p -= P.cdf(x_i);
+        while (p > 0) {
+          ++x_i;
+          p -= P.pdf(x_i);
+        }
+      }
+      return x_i;
+    }
   };
 
   // -------------------------------------------------------------------
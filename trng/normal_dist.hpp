@@ -40,6 +40,7 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/sampling_method.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -47,8 +48,53 @@
 
 namespace trng {
 
+  namespace detail {
+
+    // tables for the ziggurat method of Marsaglia and Tsang with 128 layers of equal area
+    // under the function exp(-x^2/2), see G. Marsaglia and W. W. Tsang, "The Ziggurat Method
+    // for Generating Random Variables", Journal of Statistical Software 5 (8), 2000
+    class normal_ziggurat {
+    public:
+      static constexpr int layers{128};
+      // right edge of the base layer, where the tail begins
+      static double r() { return 3.442619855899; }
+      // right edges of the layers, x[0] is the width of a rectangle with the area of the base
+      // layer (rectangle and tail) and x[layers] = 0
+      double x[layers + 1];
+      // ratios x[i + 1] / x[i], a point in layer i left of this fraction of its width lies
+      // entirely beneath the density
+      double ratio[layers];
+      // exp(-x[i]^2/2)
+      double f[layers + 1];
+
+      static const normal_ziggurat &instance() {
+        static const normal_ziggurat z;
+        return z;
+      }
+
+    private:
+      normal_ziggurat() {
+        // area of each layer
+        const double v{9.91256303526217e-3};
+        f[1] = math::exp(-0.5 * r() * r());
+        x[0] = v / f[1];
+        f[0] = 0;
+        x[1] = r();
+        for (int i{1}; i < layers - 1; ++i) {
+          x[i + 1] = math::sqrt(-2 * math::ln(v / x[i] + f[i]));
+          f[i + 1] = math::exp(-0.5 * x[i + 1] * x[i + 1]);
+        }
+        x[layers] = 0;
+        f[layers] = 1;
+        for (int i{0}; i < layers; ++i)
+          ratio[i] = x[i + 1] / x[i];
+      }
+    };
+
+  }  // namespace detail
+
   // uniform random number generator class
-  template<typename float_t = double>
+  template<typename float_t = double, typename method_t = sampling_method::inversion>
   class normal_dist {
   public:
     using result_type = float_t;
@@ -127,7 +173,7 @@ namespace trng {
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
-      return icdf(utility::uniformoo<result_type>(r));
+      return sample(r, method_t{});
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
@@ -168,27 +214,67 @@ namespace trng {
     // inverse cumulative density function
     TRNG_CUDA_ENABLE
     result_type icdf(result_type x) const { return math::inv_Phi(x) * P.sigma() + P.mu(); }
+
+  private:
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type sample(R &r, sampling_method::inversion) {
+      return icdf(utility::uniformoo<result_type>(r));
+    }
+
+    // ziggurat method, a single uniform random number provides the layer (7 bits), the sign
+    // (1 bit) and the position within the layer (remaining bits), in about 97% of all cases
+    // the random number is accepted after a single comparison
+    template<typename R>
+    result_type sample(R &r, sampling_method::rejection) {
+      const detail::normal_ziggurat &z{detail::normal_ziggurat::instance()};
+      while (true) {
+        const double u{utility::uniformco<double>(r) * 256};
+        const int j{static_cast<int>(u)};
+        const int i{j & 0x7f};
+        const double s{u - j};
+        // branch-free sign, the sign bit is unpredictable
+        const double sign{static_cast<double>(1 - 2 * (j >> 7))};
+        double x{s * z.x[i]};
+        if (s < z.ratio[i])
+          return static_cast<result_type>(sign * x) * P.sigma() + P.mu();
+        if (i == 0) {
+          // tail beyond r, see G. Marsaglia, "Generating a Variable from the Tail of the Normal
+          // Distribution", Technometrics 6 (1), 1964
+          double y;
+          do {
+            x = -math::ln(utility::uniformoo<double>(r)) / detail::normal_ziggurat::r();
+            y = -math::ln(utility::uniformoo<double>(r));
+          } while (y + y < x * x);
+          x += detail::normal_ziggurat::r();
+          return static_cast<result_type>(sign * x) * P.sigma() + P.mu();
+        }
+        // wedge between the layer's rectangle and the density
+        if (z.f[i] + utility::uniformco<double>(r) * (z.f[i + 1] - z.f[i]) <
+            math::exp(-0.5 * x * x))
+          return static_cast<result_type>(sign * x) * P.sigma() + P.mu();
+      }
+    }
   };
 
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator==(const normal_dist<float_t> &g1,
-                                          const normal_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator==(const normal_dist<float_t, method_t> &g1,
+                                          const normal_dist<float_t, method_t> &g2) {
     return g1.param() == g2.param();
   }
 
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator!=(const normal_dist<float_t> &g1,
-                                          const normal_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator!=(const normal_dist<float_t, method_t> &g1,
+                                          const normal_dist<float_t, method_t> &g2) {
     return g1.param() != g2.param();
   }
 
   // Streamable concept
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_ostream<char_t, traits_t> &operator<<(std::basic_ostream<char_t, traits_t> &out,
-                                                   const normal_dist<float_t> &g) {
+                                                   const normal_dist<float_t, method_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     out << "[normal " << g.param() << ']';
@@ -196,10 +282,10 @@ namespace trng {
     return out;
   }
 
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
-                                                   normal_dist<float_t> &g) {
-    typename normal_dist<float_t>::param_type p;
+                                                   normal_dist<float_t, method_t> &g) {
+    typename normal_dist<float_t, method_t>::param_type p;
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     in >> utility::ignore_spaces() >> utility::delim("[normal ") >> p >> utility::delim(']');
@@ -0,0 +1,370 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// This is the counter-based Philox4x32-10 generator.
+//
+// References:
+// J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw,
+//   ``Parallel random numbers: as easy as 1, 2, 3''
+//   Proceedings of 2011 International Conference for High Performance
+//   Computing, Networking, Storage and Analysis (2011) 16:1--16:12.
+
+#if !(defined TRNG_PHILOX4X32_HPP)
+
+#define TRNG_PHILOX4X32_HPP
+
+#include <trng/trng_export.hpp>
+#include <trng/cuda.hpp>
+#include <trng/limits.hpp>
+#include <trng/utility.hpp>
+#include <trng/int_types.hpp>
+#include <trng/uint128.hpp>
+#include <trng/generate_canonical.hpp>
+#include <climits>
+#include <stdexcept>
+#include <ostream>
+#include <istream>
+#include <ciso646>
+
+namespace trng {
+
+  class philox4x32 {
+  public:
+    // Uniform random number generator concept
+    using result_type = uint32_t;
+    TRNG_CUDA_ENABLE
+    result_type operator()();
+
+  private:
+    static constexpr result_type min_ = 0;
+    static constexpr result_type max_ = ~result_type(0);
+
+  public:
+    TRNG_CUDA_ENABLE
+    static constexpr result_type min() { return min_; }
+    TRNG_CUDA_ENABLE
+    static constexpr result_type max() { return max_; }
+
+  public:
+    // Parameter and status classes
+    class parameter_type {
+      result_type key[2]{0, 0};
+      uint128 increment{1};
+
+    public:
+      parameter_type() = default;
+      explicit parameter_type(result_type k0, result_type k1) : key{k0, k1} {}
+
+      friend class philox4x32;
+
+      // Equality comparable concept
+      friend bool operator==(const parameter_type &, const parameter_type &);
+      friend bool operator!=(const parameter_type &, const parameter_type &);
+
+      // Streamable concept
+      template<typename char_t, typename traits_t>
+      friend std::basic_ostream<char_t, traits_t> &operator<<(
+          std::basic_ostream<char_t, traits_t> &out, const parameter_type &P) {
+        std::ios_base::fmtflags flags(out.flags());
+        out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        out << '(' << P.key[0] << ' ' << P.key[1] << ' ' << P.increment << ')';
+        out.flags(flags);
+        return out;
+      }
+
+      template<typename char_t, typename traits_t>
+      friend std::basic_istream<char_t, traits_t> &operator>>(
+          std::basic_istream<char_t, traits_t> &in, parameter_type &P) {
+        parameter_type P_new;
+        std::ios_base::fmtflags flags(in.flags());
+        in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        in >> utility::delim('(') >> P_new.key[0] >> utility::delim(' ') >> P_new.key[1] >>
+            utility::delim(' ') >> P_new.increment >> utility::delim(')');
+        if (in)
+          P = P_new;
+        in.flags(flags);
+        return in;
+      }
+    };
+
+    class status_type {
+      // index of the next value, value i is element i % 4 of the block with counter i / 4
+      uint128 i{0};
+      // block that holds the next value
+      result_type y[4]{0, 0, 0, 0};
+
+    public:
+      status_type() = default;
+      explicit status_type(uint128 i) : i{i} {}
+
+      friend class philox4x32;
+
+      // Equality comparable concept
+      friend bool operator==(const status_type &, const status_type &);
+      friend bool operator!=(const status_type &, const status_type &);
+
+      // Streamable concept
+      template<typename char_t, typename traits_t>
+      friend std::basic_ostream<char_t, traits_t> &operator<<(
+          std::basic_ostream<char_t, traits_t> &out, const status_type &S) {
+        std::ios_base::fmtflags flags(out.flags());
+        out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        out << '(' << S.i << ')';
+        out.flags(flags);
+        return out;
+      }
+
+      template<typename char_t, typename traits_t>
+      friend std::basic_istream<char_t, traits_t> &operator>>(
+          std::basic_istream<char_t, traits_t> &in, status_type &S) {
+        status_type S_new;
+        std::ios_base::fmtflags flags(in.flags());
+        in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        in >> utility::delim('(') >> S_new.i >> utility::delim(')');
+        if (in)
+          S = S_new;
+        in.flags(flags);
+        return in;
+      }
+    };
+
+    static TRNG4_EXPORT const parameter_type Default;
+
+    // Random number engine concept
+    explicit philox4x32(parameter_type = Default);
+    explicit philox4x32(unsigned long, parameter_type = Default);
+    explicit philox4x32(unsigned long long, parameter_type = Default);
+
+    template<typename gen>
+    explicit philox4x32(gen &g, parameter_type P = Default) : P{P} {
+      seed(g);
+    }
+
+    void seed();
+    void seed(unsigned long);
+    template<typename gen>
+    void seed(gen &g) {
+      uint128 i{0};
+      for (int j{0}; j < 4; ++j) {
+        i <<= 32u;
+        i += uint128{static_cast<uint64_t>(g())};
+      }
+      S.i = i;
+      fill();
+    }
+    void seed(unsigned long long);
+
+    // Equality comparable concept
+    friend bool operator==(const philox4x32 &, const philox4x32 &);
+    friend bool operator!=(const philox4x32 &, const philox4x32 &);
+
+    // Streamable concept
+    template<typename char_t, typename traits_t>
+    friend std::basic_ostream<char_t, traits_t> &operator<<(
+        std::basic_ostream<char_t, traits_t> &out, const philox4x32 &R) {
+      std::ios_base::fmtflags flags(out.flags());
+      out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      out << '[' << philox4x32::name() << ' ' << R.P << ' ' << R.S << ']';
+      out.flags(flags);
+      return out;
+    }
+
+    template<typename char_t, typename traits_t>
+    friend std::basic_istream<char_t, traits_t> &operator>>(
+        std::basic_istream<char_t, traits_t> &in, philox4x32 &R) {
+      philox4x32::parameter_type P_new;
+      philox4x32::status_type S_new;
+      std::ios_base::fmtflags flags(in.flags());
+      in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      in >> utility::ignore_spaces();
+      in >> utility::delim('[') >> utility::delim(philox4x32::name()) >> utility::delim(' ') >>
+          P_new >> utility::delim(' ') >> S_new >> utility::delim(']');
+      if (in) {
+        R.P = P_new;
+        R.S = S_new;
+        R.fill();
+      }
+      in.flags(flags);
+      return in;
+    }
+
+    // Parallel random number generator concept
+    TRNG_CUDA_ENABLE
+    void split(unsigned int, unsigned int);
+    TRNG_CUDA_ENABLE
+    void jump2(unsigned int);
+    TRNG_CUDA_ENABLE
+    void jump(unsigned long long);
+    TRNG_CUDA_ENABLE
+    void discard(unsigned long long);
+
+    // Other useful methods
+    static const char *name();
+    TRNG_CUDA_ENABLE
+    long operator()(long);
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt first, OutputIt last);
+
+  private:
+    parameter_type P;
+    status_type S;
+    static const char *const name_str;
+
+    // apply the Philox bijection to n counters c[0][j], ..., c[3][j] in place, the loops
+    // over j are independent of each other and can be vectorized
+    template<int n>
+    TRNG_CUDA_ENABLE static void bijection(const result_type key[2], result_type c[4][n]);
+
+    // compute the block that holds the next value
+    TRNG_CUDA_ENABLE
+    void fill();
+  };
+
+  // Inline and template methods
+
+  template<int n>
+  TRNG_CUDA_ENABLE void philox4x32::bijection(const result_type key[2], result_type c[4][n]) {
+    constexpr uint64_t M0{0xD2511F53u}, M1{0xCD9E8D57u};
+    constexpr result_type W0{0x9E3779B9u}, W1{0xBB67AE85u};
+    result_type k0{key[0]}, k1{key[1]};
+    for (int r{0}; r < 10; ++r) {
+      for (int j{0}; j < n; ++j) {
+        const uint64_t p0{M0 * c[0][j]}, p1{M1 * c[2][j]};
+        const result_type c1{c[1][j]}, c3{c[3][j]};
+        c[0][j] = static_cast<result_type>(p1 >> 32u) ^ c1 ^ k0;
+        c[1][j] = static_cast<result_type>(p1);
+        c[2][j] = static_cast<result_type>(p0 >> 32u) ^ c3 ^ k1;
+        c[3][j] = static_cast<result_type>(p0);
+      }
+      k0 += W0;
+      k1 += W1;
+    }
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32::fill() {
+    const uint128 counter{S.i >> 2};
+    result_type c[4][1]{{static_cast<result_type>(counter.lo())},
+                        {static_cast<result_type>(counter.lo() >> 32u)},
+                        {static_cast<result_type>(counter.hi())},
+                        {static_cast<result_type>(counter.hi() >> 32u)}};
+    bijection<1>(P.key, c);
+    for (int j{0}; j < 4; ++j)
+      S.y[j] = c[j][0];
+  }
+
+  TRNG_CUDA_ENABLE
+  inline philox4x32::result_type philox4x32::operator()() {
+    const uint128 i{S.i};
+    const result_type y{S.y[i.lo() & 3u]};
+    S.i += P.increment;
+    if (((S.i ^ i) >> 2) != uint128{0})
+      fill();
+    return y;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline long philox4x32::operator()(long x) {
+    return static_cast<long>(utility::uniformco<double, philox4x32>(*this) * x);
+  }
+
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void philox4x32::generate(OutputIt first, OutputIt last) {
+    if (P.increment != uint128{1}) {
+      for (; first != last; ++first)
+        *first = (*this)();
+      return;
+    }
+    // finish the current block, then compute n blocks at a time
+    for (; first != last and (S.i.lo() & 3u) != 0; ++first)
+      *first = (*this)();
+    constexpr int n{8};
+    uint128 counter{S.i >> 2};
+    result_type c[4][n];
+    while (first != last) {
+      for (int j{0}; j < n; ++j) {
+        const uint128 counter_j{counter + uint128{static_cast<uint64_t>(j)}};
+        c[0][j] = static_cast<result_type>(counter_j.lo());
+        c[1][j] = static_cast<result_type>(counter_j.lo() >> 32u);
+        c[2][j] = static_cast<result_type>(counter_j.hi());
+        c[3][j] = static_cast<result_type>(counter_j.hi() >> 32u);
+      }
+      bijection<n>(P.key, c);
+      for (int j{0}; j < n and first != last; ++j) {
+        int k{0};
+        for (; k < 4 and first != last; ++k, ++first)
+          *first = c[k][j];
+        S.i += uint128{static_cast<uint64_t>(k)};
+      }
+      counter += uint128{static_cast<uint64_t>(n)};
+    }
+    fill();
+  }
+
+  // Parallel random number generator concept
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32::split(unsigned int s, unsigned int n) {
+#if !(defined TRNG_CUDA)
+    if (s < 1 or n >= s)
+      utility::throw_this(std::invalid_argument("invalid argument for trng::philox4x32::split"));
+#endif
+    if (s > 1) {
+      S.i += uint128{n} * P.increment;
+      P.increment *= uint128{s};
+      fill();
+    }
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32::jump2(unsigned int s) {
+    // the counter has 128 bits, jumping by 2^s with s >= 128 is the identity
+    if (s >= 128)
+      return;
+    S.i += (uint128{1} << static_cast<int>(s)) * P.increment;
+    fill();
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32::jump(unsigned long long s) {
+    S.i += uint128{s} * P.increment;
+    fill();
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32::discard(unsigned long long n) { jump(n); }
+
+}  // namespace trng
+
+#endif
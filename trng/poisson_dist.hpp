@@ -38,6 +38,7 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/sampling_method.hpp>
 #include <cstddef>
 #include <ostream>
 #include <istream>
@@ -54,17 +55,40 @@ namespace trng {
 
     class param_type {
     private:
+      // smallest mean for which the rejection method is employed, table lookup is used below
+      static constexpr double rejection_threshold() { return 10; }
+
       double mu_{0};
+      bool rejection_{false};
       std::vector<double> P_;
+      // guide table for fast lookup in P_
+      utility::discrete_guide_type guide_;
+      // constants of the transformed rejection method
+      double a_{0}, b_{0}, v_r_{0}, ln_inv_alpha_{0}, ln_mu_{0};
+
+      // transformed rejection is employed only if no table has been computed
+      bool use_rejection() const { return rejection_ and P_.empty(); }
 
       void calc_probabilities() {
         P_ = std::vector<double>();
+        guide_ = utility::discrete_guide_type();
+        if (rejection_ and mu_ >= rejection_threshold()) {
+          const double sqrt_mu{math::sqrt(mu_)};
+          b_ = 0.931 + 2.53 * sqrt_mu;
+          a_ = -0.059 + 0.02483 * b_;
+          v_r_ = 0.9277 - 3.6224 / (b_ - 2);
+          ln_inv_alpha_ = math::ln(1.1239 + 1.1328 / (b_ - 3.4));
+          ln_mu_ = math::ln(mu_);
+          return;
+        }
         int x = 0;
         while (x < 7 or x < 2 * mu_) {
           P_.push_back(math::GammaQ(x + 1.0, mu_));
           ++x;
         }
         P_.push_back(1);
+
+        guide_ = utility::discrete_guide(P_.begin(), P_.end());
       }
 
     public:
@@ -73,8 +97,16 @@ namespace trng {
         mu_ = mu_new;
         calc_probabilities();
       }
+      bool rejection() const { return rejection_; }
       param_type() = default;
       explicit param_type(double mu) : mu_{mu} { calc_probabilities(); }
+      explicit param_type(double mu, sampling_method::inversion) : mu_{mu} {
+        calc_probabilities();
+      }
+      explicit param_type(double mu, sampling_method::rejection)
+          : mu_{mu}, rejection_{true} {
+        calc_probabilities();
+      }
       friend class poisson_dist;
     };
 
@@ -84,28 +116,22 @@ namespace trng {
   public:
     // constructor
     explicit poisson_dist(double mu) : P{mu} {}
+    explicit poisson_dist(double mu, sampling_method::inversion m) : P{mu, m} {}
+    // the rejection method needs no table for large mu and, therefore, has a constant set-up
+    // cost, which pays off when the parameter changes frequently
+    explicit poisson_dist(double mu, sampling_method::rejection m) : P{mu, m} {}
     explicit poisson_dist(const param_type &P) : P{P} {}
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
-      double p{utility::uniformco<double>(r)};
-      const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end())};
-      int x_i{static_cast<int>(x)};
-      if (x + 1 == P.P_.size()) {
-        p -= cdf(x_i);
-        while (p > 0) {
-          ++x_i;
-          p -= pdf(x_i);
-        }
-      }
-      return x_i;
+      return sample(r, P);
     }
+    // samples directly from the given parameter, neither copies nor allocates memory
     template<typename R>
     int operator()(R &r, const param_type &p) {
-      poisson_dist g(p);
-      return g(r);
+      return sample(r, p);
     }
     // property methods
     int min() const { return 0; }
@@ -115,18 +141,61 @@ namespace trng {
     double mu() const { return P.mu(); }
     void mu(double mu_new) { P.mu(mu_new); }
     // probability density function
-    double pdf(int x) const {
+    double pdf(int x) const { return pdf(P, x); }
+    // cumulative density function
+    double cdf(int x) const { return cdf(P, x); }
+
+  private:
+    static double pdf(const param_type &P, int x) {
       return x < 0 ? 0.0 : math::exp(-P.mu() - math::ln_Gamma(x + 1.0) + x * math::ln(P.mu()));
     }
-    // cumulative density function
-    double cdf(int x) const { return x < 0 ? 0.0 : math::GammaQ(x + 1.0, P.mu()); }
+    static double cdf(const param_type &P, int x) {
+      return x < 0 ? 0.0 : math::GammaQ(x + 1.0, P.mu());
+    }
+
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      if (P.use_rejection())
+        return ptrs(r, P);
+      double p{utility::uniformco<double>(r)};
+      const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end(), P.guide_)};
+      int x_i{static_cast<int>(x)};
+      if (x + 1 == P.P_.size()) {
+        p -= cdf(P, x_i);
+        while (p > 0) {
+          ++x_i;
+          p -= pdf(P, x_i);
+        }
+      }
+      return x_i;
+    }
+
+    // transformed rejection with squeeze, see W. Hoermann, "The transformed rejection method
+    // for generating Poisson random variables", Insurance: Mathematics and Economics 12 (1),
+    // 1993
+    template<typename R>
+    static int ptrs(R &r, const param_type &P) {
+      while (true) {
+        const double u{utility::uniformco<double>(r) - 0.5};
+        const double v{utility::uniformco<double>(r)};
+        const double us{0.5 - math::abs(u)};
+        const double k{math::floor((2 * P.a_ / us + P.b_) * u + P.mu() + 0.43)};
+        if (us >= 0.07 and v <= P.v_r_)
+          return static_cast<int>(k);
+        if (k < 0 or (us < 0.013 and v > us))
+          continue;
+        if (math::ln(v) + P.ln_inv_alpha_ - math::ln(P.a_ / (us * us) + P.b_) <=
+            -P.mu() + k * P.ln_mu_ - math::ln_Gamma(k + 1))
+          return static_cast<int>(k);
+      }
+    }
   };
 
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
   bool operator==(const poisson_dist::param_type &P1, const poisson_dist::param_type &P2) {
-    return P1.mu() == P2.mu();
+    return P1.mu() == P2.mu() and P1.rejection() == P2.rejection();
   }
   bool operator!=(const poisson_dist::param_type &P1, const poisson_dist::param_type &P2) {
     return not(P1 == P2);
@@ -138,8 +207,10 @@ namespace trng {
                                                    const poisson_dist::param_type &P) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    out << '(' << std::setprecision(math::numeric_limits<double>::digits10 + 1) << P.mu()
-        << ')';
+    out << '(' << std::setprecision(math::numeric_limits<double>::digits10 + 1) << P.mu();
+    if (P.rejection())
+      out << " rejection";
+    out << ')';
     out.flags(flags);
     return out;
   }
@@ -148,11 +219,18 @@ namespace trng {
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    poisson_dist::param_type &P) {
     double mu;
+    bool rejection{false};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::delim('(') >> mu >> utility::delim(')');
+    in >> utility::delim('(') >> mu;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" rejection");
+      rejection = true;
+    }
+    in >> utility::delim(')');
     if (in)
-      P = poisson_dist::param_type(mu);
+      P = rejection ? poisson_dist::param_type(mu, sampling_method::rejection{})
+                    : poisson_dist::param_type(mu);
     in.flags(flags);
     return in;
   }
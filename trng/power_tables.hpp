@@ -0,0 +1,86 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_POWER_TABLES_HPP)
+
+#define TRNG_POWER_TABLES_HPP
+
+#include <trng/int_types.hpp>
+#include <trng/int_math.hpp>
+
+namespace trng {
+
+  // tables of powers for the output transformation of the yarn generators, the tables are
+  // defined in a source file that is generated at build time by power_tables_generator.cc,
+  // which defines either the tables for int_math::static_power or for
+  // int_math::static_compact_power, depending on the TRNG_COMPACT_POWER_TABLE option
+  namespace power_tables {
+
+    template<int32_t m, int32_t b>
+    struct tables;
+
+    template<>
+    struct tables<2147483647, 123567893> {
+      static const uint32_t power0[0x10000], power1[0x08000];
+      static const uint32_t compact_power0[0x800], compact_power1[0x400], compact_power2[0x400];
+    };
+
+    template<>
+    struct tables<2147462579, 1616076847> {
+      static const uint32_t power0[0x10000], power1[0x08000];
+      static const uint32_t compact_power0[0x800], compact_power1[0x400], compact_power2[0x400];
+    };
+
+    template<>
+    struct tables<2147461007, 889744251> {
+      static const uint32_t power0[0x10000], power1[0x08000];
+      static const uint32_t compact_power0[0x800], compact_power1[0x400], compact_power2[0x400];
+    };
+
+    // the returned object refers to the precomputed tables and is a constant expression, so
+    // that static objects are initialized without any run-time cost
+    template<int32_t m, int32_t b>
+    constexpr int_math::power_table<m, b> make() {
+#if defined TRNG_COMPACT_POWER_TABLE
+      return int_math::power_table<m, b>(tables<m, b>::compact_power0,
+                                         tables<m, b>::compact_power1,
+                                         tables<m, b>::compact_power2);
+#else
+      return int_math::power_table<m, b>(tables<m, b>::power0, tables<m, b>::power1);
+#endif
+    }
+
+  }  // namespace power_tables
+
+}  // namespace trng
+
+#endif
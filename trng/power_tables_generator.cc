@@ -0,0 +1,99 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// generates the source file with the tables that are declared in power_tables.hpp, usage:
+// power_tables_generator output_file [compact]
+
+#include <trng/int_types.hpp>
+#include <trng/int_math.hpp>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <ciso646>
+
+namespace {
+
+  // write b^(step i) mod m for 0 <= i < size as the definition of the static member name
+  template<trng::int32_t m, trng::int32_t b>
+  void write_table(std::ostream &out, const std::string &name, trng::int32_t size,
+                   trng::int32_t step) {
+    out << "    const uint32_t tables<" << m << ", " << b << ">::" << name << '[' << size
+        << "]{";
+    for (trng::int32_t i{0}; i < size; ++i) {
+      if (i % 8 == 0)
+        out << "\n        ";
+      out << trng::int_math::pow_mod<m, b>(i * step) << "u,";
+      if (i % 8 != 7)
+        out << ' ';
+    }
+    out << "};\n\n";
+  }
+
+  template<trng::int32_t m, trng::int32_t b>
+  void write_tables(std::ostream &out, bool compact) {
+    if (compact) {
+      write_table<m, b>(out, "compact_power0", 0x800, 1);
+      write_table<m, b>(out, "compact_power1", 0x400, 0x800);
+      write_table<m, b>(out, "compact_power2", 0x400, 0x200000);
+    } else {
+      write_table<m, b>(out, "power0", 0x10000, 1);
+      write_table<m, b>(out, "power1", 0x08000, 0x10000);
+    }
+  }
+
+}  // namespace
+
+
+int main(int argc, char *argv[]) {
+  if (argc != 2 and not(argc == 3 and std::string(argv[2]) == "compact")) {
+    std::cerr << "usage: " << argv[0] << " output_file [compact]\n";
+    return EXIT_FAILURE;
+  }
+  const bool compact{argc == 3};
+  std::ofstream out(argv[1]);
+  out << "// generated by power_tables_generator, do not edit\n\n"
+      << "#include <trng/power_tables.hpp>\n\n"
+      << "namespace trng {\n\n"
+      << "  namespace power_tables {\n\n";
+  write_tables<2147483647, 123567893>(out, compact);
+  write_tables<2147462579, 1616076847>(out, compact);
+  write_tables<2147461007, 889744251>(out, compact);
+  out << "  }  // namespace power_tables\n\n"
+      << "}  // namespace trng\n";
+  out.close();
+  if (not out) {
+    std::cerr << "cannot write " << argv[1] << '\n';
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
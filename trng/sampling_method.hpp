@@ -0,0 +1,64 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_SAMPLING_METHOD_HPP)
+
+#define TRNG_SAMPLING_METHOD_HPP
+
+namespace trng {
+
+  // tag types that select the algorithm by which a distribution generates its random numbers,
+  // distributions that support several algorithms take one of these tags as an optional
+  // template parameter
+  namespace sampling_method {
+
+    // inversion of the cumulative distribution function, the default method, it consumes a
+    // fixed number of uniform random numbers per sample and, therefore, plays well with
+    // leapfrog and block splitting
+    struct inversion {};
+
+    // rejection-based methods (e.g., ziggurat), usually considerably faster than inversion but
+    // consume a varying number of uniform random numbers per sample and yield a different
+    // sequence of random numbers than inversion
+    struct rejection {};
+
+    // inversion by searching a tree with eight children per node instead of a binary tree,
+    // the children of a node share one cache line (or two), which reduces the number of cache
+    // misses per sample for large tables, the tree is organized differently than the binary
+    // tree and may yield a different sequence of random numbers due to rounding
+    struct b_ary_tree {};
+
+  }  // namespace sampling_method
+
+}  // namespace trng
+
+#endif
@@ -0,0 +1,173 @@
+// Copyright (c) 2000-2024, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#if !(defined TRNG_SIMD_MRG_HPP)
+
+#define TRNG_SIMD_MRG_HPP
+
+#include <trng/int_types.hpp>
+#include <trng/int_math.hpp>
+#include <trng/mrg_parameter.hpp>
+#include <trng/mrg_status.hpp>
+#include <algorithm>
+#include <ciso646>
+
+namespace trng {
+
+  // simd_mrg holds lanes leapfrog sub-streams of one of the multiple recursive generators
+  // mrg2, ..., mrg5s or yarn2, ..., yarn5s in structure-of-arrays layout and advances all
+  // sub-streams simultaneously by loops that the compiler can vectorize, the interleaved
+  // output of the sub-streams equals the sequence of the base engine
+  template<typename R, int lanes>
+  class simd_mrg {
+    static_assert(lanes > 0, "number of lanes must be positive");
+
+  public:
+    // Uniform random number generator concept
+    using result_type = typename R::result_type;
+    using engine_type = R;
+
+    result_type operator()() {
+      if (index == lanes)
+        step();
+      return out[index++];
+    }
+
+    static constexpr result_type min() { return R::min(); }
+    static constexpr result_type max() { return R::max(); }
+
+  private:
+    template<typename P>
+    struct order_of;
+
+    template<int k, typename F>
+    struct order_of<mrg_parameter<result_type, k, F>> {
+      static constexpr int value = k;
+    };
+
+    // order of the recurrence
+    static constexpr int n = order_of<typename R::parameter_type>::value;
+    static constexpr result_type modulus = R::modulus;
+
+  public:
+    // Random number engine concept
+    explicit simd_mrg(const R &r = R()) { seed(r); }
+
+    // initialize the sub-streams from the current state of engine r
+    void seed(const R &r) {
+      for (int j{0}; j < lanes; ++j) {
+        R r_j{r};
+        if (lanes > 1)
+          r_j.split(lanes, j);
+        for (int i{0}; i < n; ++i)
+          x[i][j] = r_j.S.r[i];
+        if (j == 0)
+          std::copy(r_j.P.a, r_j.P.a + n, a);
+      }
+      head = 0;
+      index = lanes;
+    }
+
+    // Equality comparable concept
+    friend bool operator==(const simd_mrg &R1, const simd_mrg &R2) {
+      if (not std::equal(R1.a, R1.a + n, R2.a))
+        return false;
+      for (int i{0}; i < n; ++i)
+        if (not std::equal(R1.x[(R1.head + i) % n], R1.x[(R1.head + i) % n] + lanes,
+                           R2.x[(R2.head + i) % n]))
+          return false;
+      return R1.index == R2.index and
+             std::equal(R1.out + R1.index, R1.out + lanes, R2.out + R2.index);
+    }
+
+    friend bool operator!=(const simd_mrg &R1, const simd_mrg &R2) { return not(R1 == R2); }
+
+    // Other useful methods
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    void generate(OutputIt first, OutputIt last) {
+      while (first != last) {
+        if (index == lanes)
+          step();
+        for (; index < lanes and first != last; ++index, ++first)
+          *first = out[index];
+      }
+    }
+
+  private:
+    result_type a[n]{};
+    // ring of the last n values of each sub-stream, x[head] holds the most recent ones
+    result_type x[n][lanes]{};
+    int head{0};
+    result_type out[lanes]{};
+    int index{lanes};
+
+    // output transformation of yarn generators
+    template<typename E>
+    static auto transform(result_type y, int) -> decltype(E::g(y)) {
+      return y == 0 ? 0 : E::g(y);
+    }
+    // mrg generators output the state directly
+    template<typename E>
+    static result_type transform(result_type y, long) {
+      return y;
+    }
+
+    // advance all sub-streams by one step
+    void step() {
+      uint64_t t[lanes]{};
+      for (int i{0}; i < n; ++i) {
+        const uint64_t a_i{static_cast<uint32_t>(a[i])};
+        const result_type *const x_i{x[(head + i) % n]};
+        if (n == 5 and i == n - 1) {
+          for (int j{0}; j < lanes; ++j)
+            if (t[j] >= static_cast<uint64_t>(2u) * modulus * modulus)
+              t[j] -= static_cast<uint64_t>(2u) * modulus * modulus;
+        }
+        for (int j{0}; j < lanes; ++j)
+          t[j] += a_i * static_cast<uint32_t>(x_i[j]);
+      }
+      // the oldest values are replaced by the new ones
+      head = (head + n - 1) % n;
+      result_type *const x_0{x[head]};
+      for (int j{0}; j < lanes; ++j)
+        x_0[j] = int_math::modulo<modulus, n>(t[j]);
+      for (int j{0}; j < lanes; ++j)
+        out[j] = transform<R>(x_0[j], 0);
+      index = 0;
+    }
+  };
+
+}  // namespace trng
+
+#endif
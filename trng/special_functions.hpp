@@ -219,7 +219,9 @@ namespace trng {
       TRNG_CUDA_ENABLE T GammaP_ser(T a, T x) {
         const int itmax{numeric_limits<T>::digits};
         const T eps{4 * numeric_limits<T>::epsilon()};
-        if (x < eps)
+        // P(a, x) behaves as x^a / Gamma(a + 1) for small x, which is not negligible for a < 1,
+        // the series converges after very few terms for small x
+        if (x <= 0)
           return T{0};
         T xx{1 / a}, n{a}, sum{xx};
         int i{0};
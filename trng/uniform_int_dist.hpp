@@ -37,8 +37,12 @@
 #include <trng/cuda.hpp>
 #include <trng/limits.hpp>
 #include <trng/utility.hpp>
+#include <trng/int_types.hpp>
+#include <trng/int_math.hpp>
+#include <trng/sampling_method.hpp>
 #include <ostream>
 #include <istream>
+#include <type_traits>
 #include <ciso646>
 
 namespace trng {
@@ -51,6 +55,7 @@ namespace trng {
     class param_type {
     private:
       result_type a_{0}, b_{1}, d_{1};
+      bool rejection_{false};
       TRNG_CUDA_ENABLE
       result_type d() const { return d_; }
 
@@ -72,7 +77,15 @@ namespace trng {
       TRNG_CUDA_ENABLE
       param_type() = default;
       TRNG_CUDA_ENABLE
+      bool rejection() const { return rejection_; }
+      TRNG_CUDA_ENABLE
       explicit param_type(result_type a, result_type b) : a_(a), b_(b), d_(b - a) {}
+      TRNG_CUDA_ENABLE
+      explicit param_type(result_type a, result_type b, sampling_method::inversion)
+          : a_(a), b_(b), d_(b - a) {}
+      TRNG_CUDA_ENABLE
+      explicit param_type(result_type a, result_type b, sampling_method::rejection)
+          : a_(a), b_(b), d_(b - a), rejection_(true) {}
 
       friend class uniform_int_dist;
     };
@@ -85,6 +98,15 @@ namespace trng {
     TRNG_CUDA_ENABLE
     explicit uniform_int_dist(result_type a, result_type b) : P{a, b} {}
     TRNG_CUDA_ENABLE
+    explicit uniform_int_dist(result_type a, result_type b, sampling_method::inversion m)
+        : P{a, b, m} {}
+    // the rejection method maps the engine's integer output without floating point
+    // operations and without bias to the range [a, b) if the engine yields 32 or 64 random
+    // bits per call, other engines fall back to inversion
+    TRNG_CUDA_ENABLE
+    explicit uniform_int_dist(result_type a, result_type b, sampling_method::rejection m)
+        : P{a, b, m} {}
+    TRNG_CUDA_ENABLE
     explicit uniform_int_dist(const param_type &P) : P{P} {}
     // reset internal state
     TRNG_CUDA_ENABLE
@@ -92,12 +114,11 @@ namespace trng {
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
-      return static_cast<result_type>(P.d() * utility::uniformco<double>(r)) + P.a();
+      return sample(r, P);
     }
     template<typename R>
-    TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
-      uniform_int_dist g(P);
-      return g(r);
+    TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &p) {
+      return sample(r, p);
     }
     // property methods
     TRNG_CUDA_ENABLE
@@ -132,6 +153,50 @@ namespace trng {
         return 1.0;
       return static_cast<double>(x - P.a() + 1) / static_cast<double>(P.d());
     }
+
+  private:
+    template<typename R>
+    TRNG_CUDA_ENABLE static result_type sample(R &r, const param_type &P) {
+      if (P.rejection())
+        return sample(r, P, utility::engine_bits<R>{});
+      return sample(r, P, std::integral_constant<int, 0>{});
+    }
+
+    template<typename R>
+    TRNG_CUDA_ENABLE static result_type sample(R &r, const param_type &P,
+                                               std::integral_constant<int, 0>) {
+      return static_cast<result_type>(P.d() * utility::uniformco<double>(r)) + P.a();
+    }
+
+    // multiply-shift with rejection of the biased part, see D. Lemire, "Fast Random Integer
+    // Generation in an Interval", ACM Transactions on Modeling and Computer Simulation 29 (1),
+    // 2019, the division is only needed if a sample is close to the rejection region
+    template<typename R>
+    TRNG_CUDA_ENABLE static result_type sample(R &r, const param_type &P,
+                                               std::integral_constant<int, 32>) {
+      const uint32_t d{static_cast<uint32_t>(P.d())};
+      uint64_t m{static_cast<uint64_t>(static_cast<uint32_t>(r() - R::min())) * d};
+      if (static_cast<uint32_t>(m) < d) {
+        const uint32_t t{(0u - d) % d};
+        while (static_cast<uint32_t>(m) < t)
+          m = static_cast<uint64_t>(static_cast<uint32_t>(r() - R::min())) * d;
+      }
+      return static_cast<result_type>(m >> 32u) + P.a();
+    }
+
+    template<typename R>
+    TRNG_CUDA_ENABLE static result_type sample(R &r, const param_type &P,
+                                               std::integral_constant<int, 64>) {
+      const uint64_t d{static_cast<uint64_t>(P.d())};
+      uint64_t l;
+      uint64_t m{int_math::mul_hi_lo(static_cast<uint64_t>(r() - R::min()), d, l)};
+      if (l < d) {
+        const uint64_t t{(0ull - d) % d};
+        while (l < t)
+          m = int_math::mul_hi_lo(static_cast<uint64_t>(r() - R::min()), d, l);
+      }
+      return static_cast<result_type>(m) + P.a();
+    }
   };
 
   // -------------------------------------------------------------------
@@ -140,7 +205,7 @@ namespace trng {
   TRNG_CUDA_ENABLE
   inline bool operator==(const uniform_int_dist::param_type &P1,
                          const uniform_int_dist::param_type &P2) {
-    return P1.a() == P2.a() and P1.b() == P2.b();
+    return P1.a() == P2.a() and P1.b() == P2.b() and P1.rejection() == P2.rejection();
   }
   TRNG_CUDA_ENABLE
   inline bool operator!=(const uniform_int_dist::param_type &P1,
@@ -154,7 +219,10 @@ namespace trng {
                                                    const uniform_int_dist::param_type &P) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    out << '(' << P.a() << ' ' << P.b() << ')';
+    out << '(' << P.a() << ' ' << P.b();
+    if (P.rejection())
+      out << " rejection";
+    out << ')';
     out.flags(flags);
     return out;
   }
@@ -163,11 +231,18 @@ namespace trng {
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    uniform_int_dist::param_type &P) {
     int a, b;
+    bool rejection{false};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::delim('(') >> a >> utility::delim(' ') >> b >> utility::delim(')');
+    in >> utility::delim('(') >> a >> utility::delim(' ') >> b;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" rejection");
+      rejection = true;
+    }
+    in >> utility::delim(')');
     if (in)
-      P = uniform_int_dist::param_type(a, b);
+      P = rejection ? uniform_int_dist::param_type(a, b, sampling_method::rejection{})
+                    : uniform_int_dist::param_type(a, b);
     in.flags(flags);
     return in;
   }
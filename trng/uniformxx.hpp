@@ -36,8 +36,10 @@
 
 #include <trng/cuda.hpp>
 #include <trng/limits.hpp>
+#include <trng/int_types.hpp>
 #include <cstddef>
 #include <cfloat>
+#include <cstring>
 #include <ciso646>
 
 namespace trng {
@@ -104,6 +106,45 @@ namespace trng {
       static constexpr result_type domain_max =
           use_ll_of_shifted ? (domain_max0 >> 1u) : domain_max0;
 
+      // number of mantissa bits of a number in [1, 2), which co() and oo() build directly from
+      // random bits of the engine before one is subtracted, this avoids the integer to floating
+      // point conversion and the multiplication, zero if not enabled or not possible
+#if defined TRNG_U01_DIRECT_BITS
+      static constexpr unsigned int direct_mant_bits =
+          not math::numeric_limits<ret_t>::is_iec559
+              ? 0u
+              : (ret_bits == 53 ? 52u : (ret_bits == 24 ? 23u : 0u));
+#else
+      static constexpr unsigned int direct_mant_bits = 0;
+#endif
+      // number of bits of the engine's random numbers that are used by the direct construction,
+      // all bits if only a few values are missing in the range of the engine, e.g., the value
+      // 2^31 - 1 for the MRG and YARN engines with modulus 2^31 - 1, which results in a
+      // non-uniformity of about 2^-31 but retains the engine's resolution
+      static constexpr unsigned long long domain_missing =
+          (domain_bits > 0 ? ~0ull >> (64u - domain_bits) : 0ull) -
+          static_cast<unsigned long long>(domain_max0);
+      static constexpr unsigned int direct_domain_bits =
+          domain_missing <= (static_cast<unsigned long long>(domain_max0) >> 30u)
+              ? domain_bits
+              : domain_full_bits;
+      // the direct construction calls the engine as often as the conversion does, i.e., once
+      // or twice, the most significant bits of each random number are taken
+      static constexpr unsigned int direct_calls =
+          direct_mant_bits == 0
+              ? 0u
+              : (calls_needed == 1 ? 1u
+                                   : (calls_needed == 2 and
+                                              direct_domain_bits >= (direct_mant_bits + 1) / 2
+                                          ? 2u
+                                          : 0u));
+      static constexpr unsigned int direct_bits =
+          direct_calls == 1
+              ? (direct_domain_bits < direct_mant_bits ? direct_domain_bits : direct_mant_bits)
+              : (direct_mant_bits + 1) / 2;
+      static constexpr unsigned int direct_shift =
+          direct_calls > 0 and domain_bits > direct_bits ? domain_bits - direct_bits : 0;
+
       TRNG_CUDA_ENABLE
       static ret_t addin(prng_t &r) {
         const result_type x{r() - prng_t::min()};
@@ -154,6 +195,37 @@ namespace trng {
       TRNG_CUDA_ENABLE
       static ret_t oo_norm() { return cc_norm() * (ret_t(1) - 2 * eps()); }
 
+      TRNG_CUDA_ENABLE
+      static uint64_t top_bits(prng_t &r) {
+        const uint64_t x{static_cast<uint64_t>(r() - prng_t::min())};
+        return x >> direct_shift;
+      }
+      TRNG_CUDA_ENABLE
+      static uint64_t mantissa(prng_t &r) {
+        if (direct_calls == 1)
+          return top_bits(r) << (direct_mant_bits - direct_bits);
+        const uint64_t m{top_bits(r) << direct_bits};
+        return (m | top_bits(r)) >> (2 * direct_bits - direct_mant_bits);
+      }
+      TRNG_CUDA_ENABLE
+      static double from_mantissa(uint64_t m, double) {
+        const uint64_t x{0x3ff0000000000000ull | m};
+        double y;
+        std::memcpy(&y, &x, sizeof(y));
+        return y - 1.0;
+      }
+      TRNG_CUDA_ENABLE
+      static float from_mantissa(uint64_t m, float) {
+        const uint32_t x{0x3f800000u | static_cast<uint32_t>(m)};
+        float y;
+        std::memcpy(&y, &x, sizeof(y));
+        return y - 1.0f;
+      }
+      template<typename T>
+      TRNG_CUDA_ENABLE static T from_mantissa(uint64_t, T) {
+        return T(0);
+      }
+
     public:
       TRNG_CUDA_ENABLE
       static return_type cc(prng_t &r) {
@@ -161,11 +233,20 @@ namespace trng {
         return division_required ? variate(r) / variate_max() : variate(r) * cc_norm();
       }
       TRNG_CUDA_ENABLE
-      static return_type co(prng_t &r) { return variate(r) * co_norm(); }
+      static return_type co(prng_t &r) {
+        if (direct_calls > 0)
+          return from_mantissa(mantissa(r), ret_t());
+        return variate(r) * co_norm();
+      }
       TRNG_CUDA_ENABLE
       static return_type oc(prng_t &r) { return ret_t(1) - co(r); }
       TRNG_CUDA_ENABLE
-      static return_type oo(prng_t &r) { return variate(r) * oo_norm() + eps(); }
+      static return_type oo(prng_t &r) {
+        // setting the least significant bit of the mantissa excludes zero
+        if (direct_calls > 0)
+          return from_mantissa((mantissa(r) & ~uint64_t(1)) | 1u, ret_t());
+        return variate(r) * oo_norm() + eps();
+      }
     };
 
     template<typename ReturnType, std::size_t bits, typename UniformRandomNumberGenerator>
@@ -37,6 +37,7 @@
 #include <trng/cuda.hpp>
 #include <trng/limits.hpp>
 #include <trng/uniformxx.hpp>
+#include <trng/int_types.hpp>
 #include <cassert>
 #include <cstdio>
 #include <istream>
@@ -212,6 +213,75 @@ namespace trng {
       return static_cast<std::size_t>(i2);
     }
 
+    // guide table for discrete(), see H.-C. Chen and Y. Asau, "On Generating Random Variates
+    // from an Empirical Distribution", AIIE Transactions 6 (2), 1974, the number of entries n
+    // is the largest power of two not larger than the size of the cumulative distribution
+    // table and entry j is the result of discrete() for the argument j / n, the guide table is
+    // empty for small tables, where binary search is sufficiently fast, and for tables whose
+    // indices exceed 32 bits
+    using discrete_guide_type = std::vector<uint32_t>;
+
+    template<typename iter>
+    discrete_guide_type discrete_guide(iter first, iter last) {
+      discrete_guide_type guide;
+      const std::size_t size{static_cast<std::size_t>(last - first)};
+      if (size < 256 or size - 1 > 0xffffffffull)
+        return guide;
+      std::size_t n{1};
+      while (2 * n <= size)
+        n *= 2;
+      guide.reserve(n);
+      std::size_t i{1};
+      for (std::size_t j{0}; j < n; ++j) {
+        const double x{static_cast<double>(j) / static_cast<double>(n)};
+        while (i + 1 < size and x > first[i])
+          ++i;
+        guide.push_back(static_cast<uint32_t>(i));
+      }
+      return guide;
+    }
+
+    // same result as discrete(x, first, last) for non-negative x, the guide table provides a
+    // lower bound of the result, which is then found by linear search in one or two steps
+    template<typename iter>
+    std::size_t discrete(double x, iter first, iter last,
+                         const discrete_guide_type &guide) {
+      if (guide.empty())
+        return discrete(x, first, last);
+      if (x < (*first))
+        return 0;
+      const std::size_t size{static_cast<std::size_t>(last - first)}, n{guide.size()};
+      // multiplication by a power of two is exact, so x lies in [j / n, (j + 1) / n)
+      const double j_x{x * static_cast<double>(n)};
+      std::size_t i{guide[j_x < static_cast<double>(n) ? static_cast<std::size_t>(j_x) : n - 1]};
+      while (i + 1 < size and x > first[i])
+        ++i;
+      return i;
+    }
+
+    // -----------------------------------------------------------------
+
+    // number of random bits per call of an engine of type R if the engine's output covers the
+    // full range of a 32-bit or 64-bit unsigned integer and zero otherwise, outputs of such
+    // engines may be used directly as uniformly distributed bits
+    template<typename R>
+    using engine_bits = std::integral_constant<
+        int, R::max() - R::min() == 0xffffffffffffffffull
+                 ? 64
+                 : (R::max() - R::min() == 0xffffffffull ? 32 : 0)>;
+
+    // -----------------------------------------------------------------
+
+    // hint that the memory at address p will be read soon, does nothing if the compiler
+    // provides no prefetch instruction
+    inline void prefetch(const void *p) {
+#if (defined __GNUC__ || defined __clang__) && !(defined TRNG_CUDA)
+      __builtin_prefetch(p);
+#else
+      static_cast<void>(p);
+#endif
+    }
+
     // -----------------------------------------------------------------
 
     template<typename T1, typename T2, typename... Ts>
@@ -32,6 +32,7 @@
 
 #include "xoshiro256plus.hpp"
 #include "minstd.hpp"
+#include <vector>
 
 namespace trng {
 
@@ -84,6 +85,24 @@ namespace trng {
 
   // Parallel random number generator concept
 
+  const matrix<GF2, 256> &xoshiro256plus::transition_matrix(unsigned int i) {
+    static const std::vector<matrix<GF2, 256>> M_powers([]() {
+      std::vector<matrix<GF2, 256>> M(64);
+      for (int j{0}; j < 256; ++j) {
+        xoshiro256plus R;
+        R.S = status_type(j, status_type::eye{});
+        R.step();
+        const vector<GF2, 256> v{R.S.to_vector()};
+        for (int k{0}; k < 256; ++k)
+          M[0](k, j) = v(k);
+      }
+      for (std::size_t k{1}; k < M.size(); ++k)
+        M[k] = M[k - 1] * M[k - 1];
+      return M;
+    }());
+    return M_powers[i];
+  }
+
   // Other useful methods
   const char *const xoshiro256plus::name_str = "xoshiro256plus";
 
@@ -85,6 +85,8 @@ namespace trng {
         else
           *this = status_type{0, 0, 0, mask >> (i - 3 * 64)};
       }
+      explicit status_type(const vector<GF2, 256> &v)
+          : r{v.word(0), v.word(1), v.word(2), v.word(3)} {}
 
     public:
       friend class xoshiro256plus;
@@ -121,15 +123,8 @@ namespace trng {
 
       vector<GF2, 256> to_vector() const {
         vector<GF2, 256> res;
-        const result_type mask{result_type(1) << 63};
-        for (int i{0}; i < 64; ++i)
-          res(i) = GF2(((r[0] << i) & mask) > 0);
-        for (int i{0}; i < 64; ++i)
-          res(i + 64) = GF2(((r[1] << i) & mask) > 0);
-        for (int i{0}; i < 64; ++i)
-          res(i + 2 * 64) = GF2(((r[2] << i) & mask) > 0);
-        for (int i{0}; i < 64; ++i)
-          res(i + 3 * 64) = GF2(((r[3] << i) & mask) > 0);
+        for (int i{0}; i < 4; ++i)
+          res.word(i) = r[i];
         return res;
       }
     };
@@ -195,22 +190,26 @@ namespace trng {
     // Parallel random number generator concept
     //    TRNG_CUDA_ENABLE
     //    void split(unsigned int, unsigned int);
-    TRNG_CUDA_ENABLE
+    // jumping relies on host-side tables of transition matrices, hence not for CUDA devices
     void jump2(unsigned int);
-    TRNG_CUDA_ENABLE
     void jump(unsigned long long);
-    TRNG_CUDA_ENABLE
     void discard(unsigned long long);
 
     // Other useful methods
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt first, OutputIt last);
 
   private:
     status_type S;
     static const char *const name_str;
 
+    // returns M^(2^i) for i < 64, where M is the matrix of a single step
+    static const matrix<GF2, 256> &transition_matrix(unsigned int i);
+
     TRNG_CUDA_ENABLE
     void step();
   };
@@ -239,68 +238,55 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, xoshiro256plus>(*this) * x);
   }
 
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void xoshiro256plus::generate(OutputIt first, OutputIt last) {
+    result_type r0{S.r[0]}, r1{S.r[1]}, r2{S.r[2]}, r3{S.r[3]};
+    for (; first != last; ++first) {
+      const result_type t{r1 << 17};
+      r2 ^= r0;
+      r3 ^= r1;
+      r1 ^= r2;
+      r0 ^= r3;
+      r2 ^= t;
+      r3 = (r3 << 45) | (r3 >> (64 - 45));
+      *first = r0 + r3;
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+    S.r[2] = r2;
+    S.r[3] = r3;
+  }
+
   // Parallel random number generator concept
 
-  TRNG_CUDA_ENABLE
   inline void xoshiro256plus::jump2(unsigned int s) {
-    matrix<GF2, 256> M;
-    for (int i{0}; i < 256; ++i) {
-      xoshiro256plus R;
-      R.S = status_type(i, status_type::eye{});
-      R.step();
-      const vector<GF2, 256> v{R.S.to_vector()};
-      for (int j{0}; j < 256; ++j)
-        M(j, i) = v(j);
-    }
-
-    for (unsigned int i{0}; i < s; ++i)
-      M = power(M, 2);
-    const vector<GF2, 256> v0{S.to_vector()};
-    const vector<GF2, 256> v1{M * v0};
-
-    for (int j{0}; j < 4; ++j) {
-      result_type r_j{0};
-      for (int i{0}; i < 64; ++i) {
-        r_j <<= 1;
-        if (static_cast<bool>(v1(i + 64 * j)))
-          r_j |= 1;
-      }
-      S.r[j] = r_j;
+    if (s < 64) {
+      S = status_type(transition_matrix(s) * S.to_vector());
+    } else {
+      matrix<GF2, 256> M{transition_matrix(63)};
+      for (unsigned int i{63}; i < s; ++i)
+        M = M * M;
+      S = status_type(M * S.to_vector());
     }
   }
 
-  TRNG_CUDA_ENABLE
   inline void xoshiro256plus::jump(unsigned long long s) {
     if (s < 16) {
       for (unsigned int i{0}; i < s; ++i)
         step();
     } else {
-      matrix<GF2, 256> M;
-      for (int i{0}; i < 256; ++i) {
-        xoshiro256plus R;
-        R.S = status_type(i, status_type::eye{});
-        R.step();
-        const vector<GF2, 256> v{R.S.to_vector()};
-        for (int j{0}; j < 256; ++j)
-          M(j, i) = v(j);
-      }
-
-      const vector<GF2, 256> v0{S.to_vector()};
-      const vector<GF2, 256> v1{power(M, s) * v0};
-
-      for (int j{0}; j < 4; ++j) {
-        result_type r_j{0};
-        for (int i{0}; i < 64; ++i) {
-          r_j <<= 1;
-          if (static_cast<bool>(v1(i + 64 * j)))
-            r_j |= 1;
-        }
-        S.r[j] = r_j;
+      vector<GF2, 256> v{S.to_vector()};
+      unsigned int i{0};
+      while (s > 0) {
+        if (s % 2 == 1)
+          v = transition_matrix(i) * v;
+        ++i;
+        s >>= 1u;
       }
+      S = status_type(v);
     }
   }
 
-  TRNG_CUDA_ENABLE
   inline void xoshiro256plus::discard(unsigned long long s) { jump(s); }
 
 }  // namespace trng
@@ -31,6 +31,7 @@
 // OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "yarn2.hpp"
+#include "power_tables.hpp"
 
 namespace trng {
 
@@ -75,6 +76,7 @@ namespace trng {
 
   const char *yarn2::name() { return name_str; }
 
-  const int_math::power<yarn2::modulus, yarn2::gen> yarn2::g;
+  const int_math::power_table<yarn2::modulus, yarn2::gen> yarn2::g{
+      power_tables::make<yarn2::modulus, yarn2::gen>()};
 
 }  // namespace trng
@@ -31,6 +31,7 @@
 // OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "yarn3.hpp"
+#include "power_tables.hpp"
 
 namespace trng {
 
@@ -81,6 +82,7 @@ namespace trng {
 
   const char *yarn3::name() { return name_str; }
 
-  const int_math::power<yarn3::modulus, yarn3::gen> yarn3::g;
+  const int_math::power_table<yarn3::modulus, yarn3::gen> yarn3::g{
+      power_tables::make<yarn3::modulus, yarn3::gen>()};
 
 }  // namespace trng
@@ -60,7 +60,7 @@ namespace trng {
     static constexpr result_type gen = 123567893;
     static constexpr result_type min_ = 0;
     static constexpr result_type max_ = modulus - 1;
-    static TRNG4_EXPORT const int_math::power<yarn3::modulus, yarn3::gen> g;
+    static TRNG4_EXPORT const int_math::power_table<yarn3::modulus, yarn3::gen> g;
 
   public:
     TRNG_CUDA_ENABLE
@@ -144,6 +144,12 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt first, OutputIt last);
+
+    template<typename, int>
+    friend class simd_mrg;
 
   private:
     parameter_type P;
@@ -193,6 +199,29 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, yarn3>(*this) * x);
   }
 
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void yarn3::generate(OutputIt first, OutputIt last) {
+#if defined TRNG_CUDA
+    for (; first != last; ++first)
+      *first = (*this)();
+#else
+    const result_type a0{P.a[0]}, a1{P.a[1]}, a2{P.a[2]};
+    result_type r0{S.r[0]}, r1{S.r[1]}, r2{S.r[2]};
+    for (; first != last; ++first) {
+      const uint64_t t{static_cast<uint64_t>(a0) * static_cast<uint64_t>(r0) +
+                       static_cast<uint64_t>(a1) * static_cast<uint64_t>(r1) +
+                       static_cast<uint64_t>(a2) * static_cast<uint64_t>(r2)};
+      r2 = r1;
+      r1 = r0;
+      r0 = int_math::modulo<modulus, 3>(t);
+      *first = r0 == 0 ? 0 : g(r0);
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+    S.r[2] = r2;
+#endif
+  }
+
   // Parallel random number generator concept
   TRNG_CUDA_ENABLE
   inline void yarn3::split(unsigned int s, unsigned int n) {
@@ -240,6 +269,14 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void yarn3::jump2(unsigned int s) {
+#if !(defined TRNG_CUDA)
+    if (s < 64) {
+      const auto T{P.jump_table(modulus)};
+      const result_type r[3]{S.r[0], S.r[1], S.r[2]};
+      int_math::matrix_vec_mult<3>(T->A[s], r, S.r, modulus);
+      return;
+    }
+#endif
     result_type b[9], c[9]{};
     b[0] = P.a[0];
     b[1] = P.a[1];
@@ -274,6 +311,18 @@ namespace trng {
       for (unsigned int i{0}; i < s; ++i)
         step();
     } else {
+#if !(defined TRNG_CUDA)
+      const auto T{P.jump_table(modulus)};
+      unsigned int i{0};
+      while (s > 0) {
+        if (s % 2 == 1) {
+          const result_type r[3]{S.r[0], S.r[1], S.r[2]};
+          int_math::matrix_vec_mult<3>(T->A[i], r, S.r, modulus);
+        }
+        ++i;
+        s >>= 1u;
+      }
+#else
       unsigned int i{0};
       while (s > 0) {
         if (s % 2 == 1)
@@ -281,6 +330,7 @@ namespace trng {
         ++i;
         s >>= 1u;
       }
+#endif
     }
   }
 
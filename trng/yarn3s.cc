@@ -31,6 +31,7 @@
 // OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "yarn3s.hpp"
+#include "power_tables.hpp"
 
 namespace trng {
 
@@ -80,6 +81,7 @@ namespace trng {
 
   const char *yarn3s::name() { return name_str; }
 
-  const int_math::power<yarn3s::modulus, yarn3s::gen> yarn3s::g;
+  const int_math::power_table<yarn3s::modulus, yarn3s::gen> yarn3s::g{
+      power_tables::make<yarn3s::modulus, yarn3s::gen>()};
 
 }  // namespace trng
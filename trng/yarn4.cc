@@ -31,6 +31,7 @@
 // OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "yarn4.hpp"
+#include "power_tables.hpp"
 
 namespace trng {
 
@@ -85,6 +86,7 @@ namespace trng {
 
   const char *yarn4::name() { return name_str; }
 
-  const int_math::power<yarn4::modulus, yarn4::gen> yarn4::g;
+  const int_math::power_table<yarn4::modulus, yarn4::gen> yarn4::g{
+      power_tables::make<yarn4::modulus, yarn4::gen>()};
 
 }  // namespace trng
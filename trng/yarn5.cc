@@ -31,6 +31,7 @@
 // OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "yarn5.hpp"
+#include "power_tables.hpp"
 
 namespace trng {
 
@@ -87,6 +88,7 @@ namespace trng {
 
   const char *yarn5::name() { return name_str; }
 
-  const int_math::power<yarn5::modulus, yarn5::gen> yarn5::g;
+  const int_math::power_table<yarn5::modulus, yarn5::gen> yarn5::g{
+      power_tables::make<yarn5::modulus, yarn5::gen>()};
 
 }  // namespace trng
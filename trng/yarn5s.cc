@@ -31,6 +31,7 @@
 // OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "yarn5s.hpp"
+#include "power_tables.hpp"
 
 namespace trng {
 
@@ -90,6 +91,7 @@ namespace trng {
 
   const char *yarn5s::name() { return name_str; }
 
-  const int_math::power<yarn5s::modulus, yarn5s::gen> yarn5s::g;
+  const int_math::power_table<yarn5s::modulus, yarn5s::gen> yarn5s::g{
+      power_tables::make<yarn5s::modulus, yarn5s::gen>()};
 
 }  // namespace trng
@@ -60,7 +60,7 @@ namespace trng {
     static constexpr result_type gen = 889744251;
     static constexpr result_type min_ = 0;
     static constexpr result_type max_ = modulus - 1;
-    static TRNG4_EXPORT const int_math::power<yarn5s::modulus, yarn5s::gen> g;
+    static TRNG4_EXPORT const int_math::power_table<yarn5s::modulus, yarn5s::gen> g;
 
   public:
     TRNG_CUDA_ENABLE
@@ -147,6 +147,12 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    // fill [first, last) with successive random numbers, same as repeated calls of operator()
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt first, OutputIt last);
+
+    template<typename, int>
+    friend class simd_mrg;
 
   private:
     parameter_type P;
@@ -202,6 +208,37 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, yarn5s>(*this) * x);
   }
 
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void yarn5s::generate(OutputIt first, OutputIt last) {
+#if defined TRNG_CUDA
+    for (; first != last; ++first)
+      *first = (*this)();
+#else
+    const result_type a0{P.a[0]}, a1{P.a[1]}, a2{P.a[2]}, a3{P.a[3]}, a4{P.a[4]};
+    result_type r0{S.r[0]}, r1{S.r[1]}, r2{S.r[2]}, r3{S.r[3]}, r4{S.r[4]};
+    for (; first != last; ++first) {
+      uint64_t t{static_cast<uint64_t>(a0) * static_cast<uint64_t>(r0) +
+                 static_cast<uint64_t>(a1) * static_cast<uint64_t>(r1) +
+                 static_cast<uint64_t>(a2) * static_cast<uint64_t>(r2) +
+                 static_cast<uint64_t>(a3) * static_cast<uint64_t>(r3)};
+      if (t >= static_cast<uint64_t>(2u) * modulus * modulus)
+        t -= static_cast<uint64_t>(2u) * modulus * modulus;
+      t += static_cast<uint64_t>(a4) * static_cast<uint64_t>(r4);
+      r4 = r3;
+      r3 = r2;
+      r2 = r1;
+      r1 = r0;
+      r0 = int_math::modulo<modulus, 5>(t);
+      *first = r0 == 0 ? 0 : g(r0);
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+    S.r[2] = r2;
+    S.r[3] = r3;
+    S.r[4] = r4;
+#endif
+  }
+
   // Parallel random number generator concept
   TRNG_CUDA_ENABLE
   inline void yarn5s::split(unsigned int s, unsigned int n) {
@@ -279,6 +316,14 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void yarn5s::jump2(unsigned int s) {
+#if !(defined TRNG_CUDA)
+    if (s < 64) {
+      const auto T{P.jump_table(modulus)};
+      const result_type r[5]{S.r[0], S.r[1], S.r[2], S.r[3], S.r[4]};
+      int_math::matrix_vec_mult<5>(T->A[s], r, S.r, modulus);
+      return;
+    }
+#endif
     result_type b[25], c[25]{};
     b[0] = P.a[0];
     b[1] = P.a[1];
@@ -331,6 +376,18 @@ namespace trng {
       for (unsigned int i{0}; i < s; ++i)
         step();
     } else {
+#if !(defined TRNG_CUDA)
+      const auto T{P.jump_table(modulus)};
+      unsigned int i(0);
+      while (s > 0) {
+        if (s % 2 == 1) {
+          const result_type r[5]{S.r[0], S.r[1], S.r[2], S.r[3], S.r[4]};
+          int_math::matrix_vec_mult<5>(T->A[i], r, S.r, modulus);
+        }
+        ++i;
+        s >>= 1u;
+      }
+#else
       unsigned int i(0);
       while (s > 0) {
         if (s % 2 == 1)
@@ -338,6 +395,7 @@ namespace trng {
         ++i;
         s >>= 1u;
       }
+#endif
     }
   }
 
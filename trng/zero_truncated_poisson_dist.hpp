@@ -55,9 +55,12 @@ namespace trng {
     private:
       double mu_{0};
       std::vector<double> P_;
+      // guide table for fast lookup in P_
+      utility::discrete_guide_type guide_;
 
       void calc_probabilities() {
         P_ = std::vector<double>();
+        guide_ = utility::discrete_guide_type();
         int x{1};
         P_.push_back(0);
         while (x < 7 or x < 2 * mu_) {
@@ -66,6 +69,8 @@ namespace trng {
           ++x;
         }
         P_.push_back(1);
+
+        guide_ = utility::discrete_guide(P_.begin(), P_.end());
       }
 
     public:
@@ -91,22 +96,12 @@ namespace trng {
     // random numbers
     template<typename R>
     int operator()(R &r) {
-      double p{utility::uniformco<double>(r)};
-      const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end())};
-      int x_i{static_cast<int>(x)};
-      if (x + 1 == P.P_.size()) {
-        p -= cdf(x_i);
-        while (p > 0) {
-          ++x_i;
-          p -= pdf(x_i);
-        }
-      }
-      return x_i;
+      return sample(r, P);
     }
+    // samples directly from the given parameter, neither copies nor allocates memory
     template<typename R>
     int operator()(R &r, const param_type &p) {
-      zero_truncated_poisson_dist g(p);
-      return g(r);
+      return sample(r, p);
     }
     // property methods
     int min() const { return 1; }
@@ -116,17 +111,36 @@ namespace trng {
     double mu() const { return P.mu(); }
     void mu(double mu_new) { P.mu(mu_new); }
     // probability density function
-    double pdf(int x) const {
+    double pdf(int x) const { return pdf(P, x); }
+    // cumulative density function
+    double cdf(int x) const { return cdf(P, x); }
+
+  private:
+    static double pdf(const param_type &P, int x) {
       return x <= 0 ? 0.0
                     : math::exp(-math::ln_Gamma(x + 1.0) + x * math::ln(P.mu())) /
                           math::expm1(P.mu());
     }
-    // cumulative density function
-    double cdf(int x) const {
+    static double cdf(const param_type &P, int x) {
       return x <= 0 ? 0.0
                     : (math::exp(P.mu()) * math::GammaQ(x + 1.0, P.mu()) - 1) /
                           math::expm1(P.mu());
     }
+
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      double p{utility::uniformco<double>(r)};
+      const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end(), P.guide_)};
+      int x_i{static_cast<int>(x)};
+      if (x + 1 == P.P_.size()) {
+        p -= cdf(P, x_i);
+        while (p > 0) {
+          ++x_i;
+          p -= pdf(P, x_i);
+        }
+      }
+      return x_i;
+    }
   };
 
   // -------------------------------------------------------------------